@@ -0,0 +1,37 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "Crc8.h"
+
+byte crc8 (const byte *data, byte len) {
+	byte crc = 0;
+
+	while (len--) {
+		byte b = *data++;
+		for (byte i = 0; i < 8; i++) {
+			byte mix = (crc ^ b) & 0x01;
+			crc >>= 1;
+			if (mix)
+				crc ^= 0x8C;
+			b >>= 1;
+		}
+	}
+
+	return crc;
+}
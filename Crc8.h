@@ -0,0 +1,28 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _CRC8_H_
+#define _CRC8_H_
+
+#include <Arduino.h>
+
+// Dallas/Maxim CRC-8, same as the one used on the 1-Wire bus
+byte crc8 (const byte *data, byte len);
+
+#endif
@@ -0,0 +1,175 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "History.h"
+
+/* Keep this in check, since it all lives in RAM: this should not grow without
+ * a good reason.
+ */
+static_assert (sizeof (History) <= HISTORY_RAM_BUDGET, "History takes more RAM than budgeted");
+static_assert (sizeof (HistoryBucket) == 5, "HistoryBucket is not packed as expected");
+
+// Hundredths of degree to half degrees, rounded and clamped
+static int toHalfDegrees (int celsius) {
+	int x = (celsius + (celsius >= 0 ? 25 : -25)) / 50;
+
+	return constrain (x, HISTORY_NO_TEMP + 1, -HISTORY_NO_TEMP - 1);
+}
+
+static void printHalfDegrees (Print& out, int x) {
+	if (x != HISTORY_NO_TEMP) {
+		if (x < 0) {
+			out.print ('-');
+			x = -x;
+		}
+		out.print (x / 2);
+		out.print (x % 2 ? F(".5") : F(".0"));
+	}
+}
+
+void History::Accumulator::reset () {
+	sum = 0;
+	count = 0;
+	tMin = 32767;
+	tMax = -32768;
+	relays = 0;
+}
+
+void History::Accumulator::add (int celsius) {
+	sum += celsius;
+	++count;
+	if (celsius < tMin)
+		tMin = celsius;
+	if (celsius > tMax)
+		tMax = celsius;
+}
+
+void History::Accumulator::toBucket (HistoryBucket& bucket) const {
+	if (count > 0) {
+		bucket.tMin = toHalfDegrees (tMin);
+		bucket.tAvg = toHalfDegrees (sum / count);
+		bucket.tMax = toHalfDegrees (tMax);
+	} else {
+		bucket.tMin = bucket.tAvg = bucket.tMax = HISTORY_NO_TEMP;
+	}
+	bucket.relays = relays;
+}
+
+History::History (): fineHead (0), fineCount (0), coarseHead (0), coarseCount (0),
+	fineInCoarse (0), bucketStart (0), cursor (0) {
+
+	fineAcc.reset ();
+	coarseAcc.reset ();
+}
+
+void History::addSample (int celsius) {
+	fineAcc.add (celsius);
+}
+
+void History::closeFineBucket () {
+	HistoryBucket& bucket = fine[fineHead];
+	fineAcc.toBucket (bucket);
+	fineHead = (fineHead + 1) % HISTORY_FINE_LEN;
+	if (fineCount < HISTORY_FINE_LEN)
+		++fineCount;
+
+	// Coarse buckets are built out of fine ones
+	if (bucket.tAvg != HISTORY_NO_TEMP) {
+		coarseAcc.sum += fineAcc.sum;
+		coarseAcc.count += fineAcc.count;
+		coarseAcc.tMin = min (coarseAcc.tMin, fineAcc.tMin);
+		coarseAcc.tMax = max (coarseAcc.tMax, fineAcc.tMax);
+	}
+	coarseAcc.relays |= bucket.relays;
+	fineAcc.reset ();
+
+	if (++fineInCoarse >= HISTORY_COARSE_RATIO) {
+		coarseAcc.toBucket (coarse[coarseHead]);
+		coarseHead = (coarseHead + 1) % HISTORY_COARSE_LEN;
+		if (coarseCount < HISTORY_COARSE_LEN)
+			++coarseCount;
+		coarseAcc.reset ();
+		fineInCoarse = 0;
+	}
+}
+
+void History::loop (byte relays) {
+	fineAcc.relays |= relays;
+
+	while (millis () - bucketStart >= HISTORY_FINE_PERIOD) {
+		closeFineBucket ();
+		bucketStart += HISTORY_FINE_PERIOD;
+		fineAcc.relays = relays;
+	}
+}
+
+void History::rewind () {
+	cursor = 0;
+}
+
+/* Rows are: a header, then fine buckets, then coarse buckets, oldest first.
+ * Every row has the resolution ("f" or "c"), how many minutes ago the interval
+ * ended, min/avg/max temperature (empty if unknown) and the relay bitmask.
+ */
+boolean History::printRow (Print& out) {
+	const HistoryBucket *bucket;
+	unsigned long age;
+	char res;
+
+	if (cursor == 0) {
+		out.print (F("res,age,min,avg,max,relays\r\n"));
+		++cursor;
+		return true;
+	}
+
+	byte i = cursor - 1;
+	if (i < fineCount) {
+		byte n = fineCount - 1 - i;			// How many buckets ago
+		bucket = &fine[(fineHead + HISTORY_FINE_LEN - 1 - n) % HISTORY_FINE_LEN];
+		age = n * HISTORY_FINE_PERIOD;
+		res = 'f';
+	} else if ((i -= fineCount) < coarseCount) {
+		byte n = coarseCount - 1 - i;
+		bucket = &coarse[(coarseHead + HISTORY_COARSE_LEN - 1 - n) % HISTORY_COARSE_LEN];
+		age = (n * HISTORY_COARSE_RATIO + fineInCoarse) * HISTORY_FINE_PERIOD;
+		res = 'c';
+	} else {
+		return false;
+	}
+
+	// Count from the start of the current interval
+	age = (age + millis () - bucketStart) / 60000UL;
+
+	out.print (res);
+	out.print (',');
+	out.print (age);
+	out.print (',');
+	printHalfDegrees (out, bucket -> tMin);
+	out.print (',');
+	printHalfDegrees (out, bucket -> tAvg);
+	out.print (',');
+	printHalfDegrees (out, bucket -> tMax);
+	out.print (',');
+	out.print (bucket -> relays);
+	out.print (F("\r\n"));
+
+	++cursor;
+
+	return true;
+}
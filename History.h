@@ -0,0 +1,90 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _HISTORY_H_
+#define _HISTORY_H_
+
+#include <Arduino.h>
+#include "common.h"
+
+// Marks a bucket without any temperature reading
+#define HISTORY_NO_TEMP -512
+
+/* Summary of a time interval. Temperatures are in half degrees Celsius, in 10
+ * bits, which gives a range of -255.5 to +255.5 *C, more than enough for the
+ * -55 to +125 *C of the DS18B20.
+ */
+struct __attribute__ ((packed)) HistoryBucket {
+	int16_t tMin: 10;
+	int16_t tAvg: 10;
+	int16_t tMax: 10;
+	byte relays;			// Bit n is set if relay n + 1 was on at any time (first 8 only)
+};
+
+/* Temperature and relay history, kept in RAM at two resolutions: the last
+ * HISTORY_FINE_LEN intervals of HISTORY_FINE_PERIOD (i.e. about the last hour)
+ * and the last HISTORY_COARSE_LEN intervals of HISTORY_COARSE_RATIO fine ones
+ * (i.e. about the last day).
+ *
+ * History can be exported as CSV one row at a time, so that there is never any
+ * need to build the whole thing in memory.
+ */
+class History {
+public:
+	History ();
+
+	// Temperature in hundredths of degree Celsius
+	void addSample (int celsius);
+
+	// Closes intervals as time goes by, relays is a bitmask of the ones now on
+	void loop (byte relays);
+
+	// Starts a new export
+	void rewind ();
+
+	// Prints the next row of the export, returns false when there are no more
+	boolean printRow (Print& out);
+
+private:
+	// Fixed-width, so that this takes the same room everywhere
+	struct Accumulator {
+		int32_t sum;
+		uint16_t count;
+		int16_t tMin;
+		int16_t tMax;
+		byte relays;
+
+		void reset ();
+		void add (int celsius);
+		void toBucket (HistoryBucket& bucket) const;
+	};
+
+	HistoryBucket fine[HISTORY_FINE_LEN];
+	HistoryBucket coarse[HISTORY_COARSE_LEN];
+	byte fineHead, fineCount;
+	byte coarseHead, coarseCount;
+	byte fineInCoarse;
+	unsigned long bucketStart;
+	Accumulator fineAcc, coarseAcc;
+	byte cursor;
+
+	void closeFineBucket ();
+};
+
+#endif
@@ -0,0 +1,333 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include <EEPROM.h>
+#include "common.h"
+#include "debug.h"
+#include "Crc8.h"
+#include "Journal.h"
+#ifdef ENABLE_SCENES
+#include "Scenes.h"
+#endif
+
+struct JournalRecord {
+	byte seq;
+	byte id;				// Relay id, or scene/group record id
+	byte flags;				// Mode in bits 0-2, state in bit 3, units in bit 4, scheduled in bit 5
+	byte threshold;
+	byte hysteresis;
+	byte delay;
+	byte sensor;
+	byte crc;
+};
+
+#define RECORD_SIZE sizeof (JournalRecord)
+
+/* Sequence numbers are a single byte, so the ring can't have more slots than
+ * that, or the head could no longer be told apart (see begin()). This leaves
+ * some EEPROM unused on boards with more than 2 KB of it.
+ */
+#define MAX_SLOTS 255
+
+// The ring should at least be able to hold a record per relay
+#ifdef E2END
+static_assert (EEPROM_JOURNAL_ADDR + RELAYS_NO * RECORD_SIZE <= E2END + 1, "Not enough EEPROM left for the journal");
+#endif
+
+// Part of the record that holds the options, used to tell if anything changed
+#define PAYLOAD_OFFSET offsetof (JournalRecord, flags)
+#define PAYLOAD_SIZE (offsetof (JournalRecord, crc) - PAYLOAD_OFFSET)
+
+static int slotAddress (unsigned int slot) {
+	return EEPROM_JOURNAL_ADDR + slot * RECORD_SIZE;
+}
+
+static boolean readRecord (unsigned int slot, JournalRecord& rec) {
+	EEPROM.get (slotAddress (slot), rec);
+
+	boolean validId = rec.id >= 1 && rec.id <= RELAYS_NO;
+#ifdef ENABLE_SCENES
+	validId = validId || Scenes::isRecordId (rec.id);
+#endif
+
+	return validId &&
+		crc8 (reinterpret_cast<const byte *> (&rec), RECORD_SIZE - 1) == rec.crc;
+}
+
+static void packRecord (const RelayOptions& opts, byte id, JournalRecord& rec) {
+	rec.id = id;
+	rec.flags = (opts.mode & 0x07) | (opts.state == RELAY_ON ? 0x08 : 0) | (opts.units == TEMP_F ? 0x10 : 0) |
+	            (opts.scheduled ? 0x20 : 0);
+	rec.threshold = opts.threshold;
+	rec.hysteresis = opts.hysteresis;
+	rec.delay = opts.delay;
+	rec.sensor = opts.sensor;
+}
+
+static void unpackRecord (const JournalRecord& rec, RelayOptions& opts) {
+	opts.mode = static_cast<RelayMode> (rec.flags & 0x07);
+	opts.state = (rec.flags & 0x08) ? RELAY_ON : RELAY_OFF;
+	opts.units = (rec.flags & 0x10) ? TEMP_F : TEMP_C;
+	opts.scheduled = (rec.flags & 0x20) != 0;
+	opts.threshold = rec.threshold;
+	opts.hysteresis = rec.hysteresis;
+	opts.delay = rec.delay;
+	opts.sensor = rec.sensor < MAX_SENSORS ? rec.sensor : DEFAULT_RELAY_SENSOR;
+}
+
+Journal::Journal (): bytesWritten (0), recordsWritten (0), changesCoalesced (0),
+	relays (NULL), head (-1), seq (0), dirty (0), bulk (0), dirtySince (0) {
+
+	nSlots = (EEPROM.length () - EEPROM_JOURNAL_ADDR) / RECORD_SIZE;
+	if (nSlots > MAX_SLOTS)
+		nSlots = MAX_SLOTS;
+	for (byte i = 0; i < RELAYS_NO; i++)
+		lastSlot[i] = -1;
+}
+
+void Journal::begin (Relay *_relays) {
+	JournalRecord rec, next;
+
+	relays = _relays;
+
+	/* Records are written sequentially, each with a sequence number one more
+	 * than the previous one, so the most recent record is the one that is not
+	 * followed by its successor. Since there are at most MAX_SLOTS, there
+	 * can only be one such record, unless something got corrupted, in which
+	 * case we take the newest one.
+	 */
+	head = -1;
+	for (unsigned int i = 0; i < nSlots; i++) {
+		if (readRecord (i, rec)) {
+			boolean last = !readRecord ((i + 1) % nSlots, next) || next.seq != static_cast<byte> (rec.seq + 1);
+			if (last && (head < 0 || static_cast<int8_t> (rec.seq - seq) > 0)) {
+				head = i;
+				seq = rec.seq;
+			}
+		}
+	}
+
+	// Walk back from the head and apply the first record found for every relay
+	if (head >= 0) {
+		unsigned int slot = head;
+		byte expected = seq, found = 0;
+
+		for (unsigned int n = 0; n < nSlots && found < RELAYS_NO; n++) {
+			if (!readRecord (slot, rec) || rec.seq != expected)
+				break;
+
+#ifdef ENABLE_SCENES
+			if (Scenes::isRecordId (rec.id)) {
+				// Only the mode comes from here, the rest is in the fixed slots
+				for (byte i = 0; i < RELAYS_NO; i++) {
+					byte mode = Scenes::modeFor (rec.id, rec.flags, i);
+					if (mode != SCENE_KEEP && lastSlot[i] < 0) {
+						relays[i].mode = static_cast<RelayMode> (mode);
+						lastSlot[i] = slot;
+						bulk |= static_cast<RelayMask> (1) << i;
+						++found;
+					}
+				}
+			} else
+#endif
+			{
+				byte i = rec.id - 1;
+				if (lastSlot[i] < 0) {
+					unpackRecord (rec, relays[i]);
+					lastSlot[i] = slot;
+					++found;
+				}
+			}
+
+			--expected;
+			slot = (slot == 0 ? nSlots : slot) - 1;
+		}
+
+		DPRINT (F("Journal head is at slot "));
+		DPRINT (head);
+		DPRINT (F(", recovered "));
+		DPRINT (found);
+		DPRINTLN (F(" relays"));
+	} else {
+		DPRINTLN (F("Journal is empty"));
+	}
+}
+
+void Journal::format () {
+	for (unsigned int i = 0; i < nSlots; i++)
+		updateByte (slotAddress (i) + offsetof (JournalRecord, id), 0xFF);
+
+	head = -1;
+	bulk = 0;
+	for (byte i = 0; i < RELAYS_NO; i++)
+		lastSlot[i] = -1;
+}
+
+void Journal::markDirty (byte id) {
+	if (id >= 1 && id <= RELAYS_NO) {
+		RelayMask bit = static_cast<RelayMask> (1) << (id - 1);
+
+		if (dirty == 0)
+			dirtySince = millis ();
+		else if (dirty & bit)
+			++changesCoalesced;
+
+		dirty |= bit;
+	}
+}
+
+void Journal::flush () {
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		if ((dirty >> i) & 0x01)
+			saveRelay (relays[i]);
+	}
+
+	dirty = 0;
+}
+
+void Journal::loop () {
+	if (dirty != 0 && millis () - dirtySince >= JOURNAL_FLUSH_DELAY)
+		flush ();
+}
+
+void Journal::updateByte (int addr, byte val) {
+	if (EEPROM.read (addr) != val) {
+		EEPROM.write (addr, val);
+		++bytesWritten;
+	}
+}
+
+void Journal::saveFixed (byte i) {
+	byte image[RELAY_IMAGE_SIZE];
+
+	packOptions (relays[i], image);
+	for (byte k = 0; k < RELAY_IMAGE_SIZE; k++)
+		updateByte (relays[i].optionsAddress () + k, image[k]);
+}
+
+unsigned int Journal::nextSlot () {
+	unsigned int slot = head < 0 ? 0 : (head + 1) % nSlots;
+
+	/* If we are about to overwrite the last record left for some relay, save
+	 * its options to its fixed slot first.
+	 */
+	for (byte j = 0; j < RELAYS_NO; j++) {
+		if (lastSlot[j] == static_cast<int> (slot)) {
+			saveFixed (j);
+			lastSlot[j] = -1;
+			bulk &= ~(static_cast<RelayMask> (1) << j);
+		}
+	}
+
+	return slot;
+}
+
+void Journal::writeRecord (unsigned int slot, JournalRecord& rec) {
+	rec.seq = ++seq;
+	rec.crc = crc8 (reinterpret_cast<const byte *> (&rec), RECORD_SIZE - 1);
+
+	// CRC is written last, so that a torn write can be detected
+	const byte *p = reinterpret_cast<const byte *> (&rec);
+	for (byte k = 0; k < RECORD_SIZE; k++)
+		updateByte (slotAddress (slot) + k, p[k]);
+
+	head = slot;
+	++recordsWritten;
+}
+
+void Journal::saveRelay (Relay& relay) {
+	JournalRecord rec, old;
+	byte i = relay.id - 1;
+
+	// Don't write anything if the options are the same as the saved ones
+	if (lastSlot[i] >= 0 && !((bulk >> i) & 0x01)) {
+		readRecord (lastSlot[i], old);
+	} else {
+		RelayOptions saved;
+		byte image[RELAY_IMAGE_SIZE];
+		for (byte k = 0; k < RELAY_IMAGE_SIZE; k++)
+			image[k] = EEPROM.read (relay.optionsAddress () + k);
+		unpackOptions (image, saved);
+		if (lastSlot[i] >= 0)
+			saved.mode = relay.mode;		// Set by a scene, only other options can have changed
+		packRecord (saved, relay.id, old);
+	}
+
+	packRecord (relay, relay.id, rec);
+	if (memcmp (reinterpret_cast<byte *> (&rec) + PAYLOAD_OFFSET, reinterpret_cast<byte *> (&old) + PAYLOAD_OFFSET, PAYLOAD_SIZE) == 0) {
+		++changesCoalesced;
+	} else {
+		// Only now, as this might move some other relay to its fixed slot
+		unsigned int slot = nextSlot ();
+
+		DPRINT (F("Journaling options for relay "));
+		DPRINT (relay.id);
+		DPRINT (F(" to slot "));
+		DPRINTLN (slot);
+
+		writeRecord (slot, rec);
+		lastSlot[i] = slot;
+		bulk &= ~(static_cast<RelayMask> (1) << i);
+	}
+}
+
+#ifdef ENABLE_SCENES
+void Journal::saveBulk (byte recordId, byte flags, RelayMask affected) {
+	JournalRecord rec;
+
+	/* The record will only restore the modes, so make sure the fixed slots
+	 * hold the latest version of everything else. This is only needed the
+	 * first time a relay is affected by a scene after other changes.
+	 */
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		RelayMask bit = static_cast<RelayMask> (1) << i;
+		if ((affected & bit) && ((dirty & bit) || (lastSlot[i] >= 0 && !(bulk & bit))))
+			saveFixed (i);
+	}
+
+	unsigned int slot = nextSlot ();
+
+	DPRINT (F("Journaling scene/group "));
+	DPRINT (recordId, HEX);
+	DPRINT (F(" to slot "));
+	DPRINTLN (slot);
+
+	memset (&rec, 0, sizeof (rec));
+	rec.id = recordId;
+	rec.flags = flags;
+	writeRecord (slot, rec);
+
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		if ((affected >> i) & 0x01)
+			lastSlot[i] = slot;
+	}
+	bulk |= affected;
+	dirty &= ~affected;
+}
+
+void Journal::checkpoint () {
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		if (lastSlot[i] >= 0 || ((dirty >> i) & 0x01))
+			saveFixed (i);
+	}
+
+	dirty = 0;
+	format ();
+}
+#endif
@@ -0,0 +1,99 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _JOURNAL_H_
+#define _JOURNAL_H_
+
+#include <Arduino.h>
+#include "Relay.h"
+
+struct JournalRecord;
+
+/* Wear-leveled storage for relay options.
+ *
+ * Relays used to save their options to their own fixed EEPROM slot every time
+ * they switched, so a temperature-controlled relay hovering around its
+ * threshold kept rewriting the very same cells. Now changes are only marked
+ * as dirty in RAM and written out after JOURNAL_FLUSH_DELAY, so that a burst
+ * of changes results in a single write. Writes are appended as small records
+ * to a ring spanning all the EEPROM that is not otherwise used, so that wear
+ * is spread over all of it.
+ *
+ * At boot the options are read from the fixed slots first, then the most
+ * recent record for each relay found in the ring (if any) is applied on top.
+ * The fixed slot of a relay is only rewritten when its last record is about to
+ * be overwritten by the ring wrapping around.
+ *
+ * Scenes and groups are journaled as a single record, which only tells which
+ * one was applied and leaves the other options of the affected relays to their
+ * fixed slots. Since such a record is replayed with the scene definition found
+ * at boot, the journal must be checkpointed before redefining any.
+ */
+class Journal {
+public:
+	// Statistics
+	unsigned long bytesWritten;		// Physical EEPROM bytes actually changed
+	unsigned long recordsWritten;
+	unsigned long changesCoalesced;	// Changes that didn't need a write of their own
+
+	Journal ();
+
+	// Recovers the latest options of all relays
+	void begin (Relay *_relays);
+
+	// Invalidates all records, to be used when formatting the EEPROM
+	void format ();
+
+	// Schedules the options of the given relay (1-based) to be saved
+	void markDirty (byte id);
+
+	// Saves everything now
+	void flush ();
+
+	// Saves dirty relays once their deadline expires
+	void loop ();
+
+#ifdef ENABLE_SCENES
+	/* Records that a scene or group was applied to the given relays, whose
+	 * modes must already be updated
+	 */
+	void saveBulk (byte recordId, byte flags, RelayMask affected);
+
+	// Moves all options to the fixed slots and empties the ring
+	void checkpoint ();
+#endif
+
+private:
+	Relay *relays;
+	unsigned int nSlots;
+	int head;						// Slot of the most recent record, -1 if none
+	byte seq;						// Sequence number of the most recent record
+	int lastSlot[RELAYS_NO];		// Slot of the most recent record of every relay
+	RelayMask dirty;
+	RelayMask bulk;					// Relays whose most recent record is a scene or group
+	unsigned long dirtySince;
+
+	void updateByte (int addr, byte val);
+	void saveFixed (byte i);
+	unsigned int nextSlot ();
+	void writeRecord (unsigned int slot, JournalRecord& rec);
+	void saveRelay (Relay& relay);
+};
+
+#endif
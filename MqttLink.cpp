@@ -0,0 +1,126 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "common.h"
+
+#ifdef ENABLE_MQTT
+
+#include "MqttLink.h"
+#include "debug.h"
+
+MqttLink *MqttLink::instance = NULL;
+
+MqttLink::MqttLink (Client& client): mqtt (client), callback (NULL),
+	lastAttempt (0), publishedVersion (0), changedAt (0), pending (false) {
+}
+
+void MqttLink::begin (const IPAddress& broker, word port, MqttCommandCallback _callback) {
+	// PubSubClient takes a plain function, and there is only one link anyway
+	instance = this;
+	callback = _callback;
+
+	mqtt.setServer (broker, port);
+	mqtt.setCallback (received);
+
+	connect ();
+}
+
+const char *MqttLink::makeTopic (PGM_P subtopic) {
+	strcpy (topic, MQTT_PREFIX "/");
+	strcat_P (topic, subtopic);
+
+	return topic;
+}
+
+boolean MqttLink::connect () {
+	lastAttempt = millis ();
+
+	boolean ok = mqtt.connect (MQTT_PREFIX, makeTopic (PSTR ("status")), 0, true, "offline");
+	if (ok) {
+		DPRINTLN (F("Connected to MQTT broker"));
+
+		ok = publish (PSTR ("status"), "online") &&
+		     mqtt.subscribe (makeTopic (PSTR ("relay/+/set")));
+
+		// Republish everything right away
+		publishedVersion = 0;
+		pending = true;
+		changedAt = millis () - MQTT_COALESCE_MS;
+	} else {
+		DPRINT (F("Cannot connect to MQTT broker: "));
+		DPRINTLN (mqtt.state ());
+	}
+
+	return ok;
+}
+
+void MqttLink::loop () {
+	if (mqtt.connected ())
+		mqtt.loop ();
+	else if (millis () - lastAttempt >= MQTT_RETRY_INTERVAL)
+		connect ();
+}
+
+boolean MqttLink::due (unsigned long version, unsigned long& since) {
+	if (version == publishedVersion || !mqtt.connected ())
+		return false;
+
+	if (!pending) {
+		pending = true;
+		changedAt = millis ();
+	}
+
+	if (millis () - changedAt < MQTT_COALESCE_MS)
+		return false;
+
+	since = publishedVersion;
+	publishedVersion = version;
+	pending = false;
+
+	return true;
+}
+
+boolean MqttLink::publish (PGM_P subtopic, const char *payload) {
+	return mqtt.publish (makeTopic (subtopic), payload, true);
+}
+
+void MqttLink::received (char *topic, byte *payload, unsigned int length) {
+	// Expect MQTT_PREFIX/relay/N/set
+	static const char RELAY_TOPIC[] PROGMEM = MQTT_PREFIX "/relay/";
+	if (strncmp_P (topic, RELAY_TOPIC, sizeof (RELAY_TOPIC) - 1) != 0)
+		return;
+
+	topic += sizeof (RELAY_TOPIC) - 1;
+	int relayNo = 0;
+	for (; isdigit (*topic); ++topic)
+		relayNo = relayNo * 10 + (*topic - '0');
+
+	if (strcmp_P (topic, PSTR ("/set")) != 0 || relayNo < 1 || relayNo > RELAYS_NO ||
+	    length >= PAYLOAD_LEN || !instance -> callback)
+		return;
+
+	// The payload is not terminated
+	char buf[PAYLOAD_LEN];
+	memcpy (buf, payload, length);
+	buf[length] = '\0';
+
+	instance -> callback (relayNo, buf);
+}
+
+#endif
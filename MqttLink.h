@@ -0,0 +1,79 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _MQTTLINK_H_
+#define _MQTTLINK_H_
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include "common.h"
+
+// Called with the relay number (1-based) and payload of a command
+typedef void (*MqttCommandCallback) (byte relayNo, const char *payload);
+
+/* Connection to an MQTT broker.
+ *
+ * All topics start with MQTT_PREFIX, e.g. "smartstrip/status", which is kept
+ * set (retained) to "online", and turned to "offline" by the broker when the
+ * connection is lost. Messages published to MQTT_PREFIX/relay/N/set are handed
+ * to the command callback. If the connection drops, it is attempted again every
+ * MQTT_RETRY_INTERVAL.
+ */
+class MqttLink {
+public:
+	MqttLink (Client& client);
+
+	void begin (const IPAddress& broker, word port, MqttCommandCallback _callback);
+
+	// Keeps the connection up and delivers commands, call this often
+	void loop ();
+
+	/* Tells whether the state should be published: this happens when version
+	 * has changed and MQTT_COALESCE_MS have passed since the first change that
+	 * was not published yet, so that all the changes in between go out
+	 * together. since is set to the last version that was published, 0 after
+	 * every (re)connection, as the broker might have lost everything.
+	 */
+	boolean due (unsigned long version, unsigned long& since);
+
+	// Publishes a retained message to MQTT_PREFIX/subtopic
+	boolean publish (PGM_P subtopic, const char *payload);
+
+private:
+	// Longest command payload accepted
+	static const byte PAYLOAD_LEN = 8;
+
+	static MqttLink *instance;
+
+	PubSubClient mqtt;
+	MqttCommandCallback callback;
+	unsigned long lastAttempt;
+	unsigned long publishedVersion;
+	unsigned long changedAt;
+	boolean pending;
+	char topic[sizeof (MQTT_PREFIX) + 16];
+
+	boolean connect ();
+
+	const char *makeTopic (PGM_P subtopic);
+
+	static void received (char *topic, byte *payload, unsigned int length);
+};
+
+#endif
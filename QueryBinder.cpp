@@ -0,0 +1,337 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "QueryBinder.h"
+
+// Reads a percent-encoded value up to the next '&', a char at a time
+class ValueReader {
+public:
+	ValueReader (const char *_p): p (_p) {
+	}
+
+	// Returns the next decoded char, or -1 at the end of the value
+	int next () {
+		char c = *p;
+		if (c == '\0' || c == '&')
+			return -1;
+
+		++p;
+		if (c == '+') {
+			return ' ';
+		} else if (c == '%') {
+			int hi = hexValue (p[0]);
+			int lo = hi >= 0 ? hexValue (p[1]) : -1;
+			if (lo < 0)
+				return '%';		// Malformed, no valid value contains this anyway
+
+			p += 2;
+			return (hi << 4) | lo;
+		}
+
+		return c;
+	}
+
+	// Where the value ended, call after next() has returned -1
+	const char *end () const {
+		return p;
+	}
+
+	static int hexValue (int c) {
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		else if (c >= 'a' && c <= 'f')
+			return c - 'a' + 10;
+		else if (c >= 'A' && c <= 'F')
+			return c - 'A' + 10;
+		else
+			return -1;
+	}
+
+private:
+	const char *p;
+};
+
+/* Parses count numbers in the given base, each fitting in a byte, separated by
+ * sep (or also by alt). out is only written if all of them are valid.
+ */
+static boolean parseBytes (ValueReader& r, byte *out, byte count, byte base, char sep, char alt) {
+	byte buf[6];
+	int c = r.next ();
+
+	for (byte i = 0; i < count; i++) {
+		unsigned int acc = 0;
+		byte digits = 0;
+
+		for (; ; c = r.next ()) {
+			int d = base == 16 ? ValueReader::hexValue (c) : (c >= '0' && c <= '9' ? c - '0' : -1);
+			if (d < 0)
+				break;
+
+			acc = acc * base + d;
+			if (++digits > 3 || acc > 0xFF)
+				return false;
+		}
+
+		if (digits == 0)
+			return false;
+
+		buf[i] = acc;
+
+		if (i < count - 1) {
+			if (c != sep && c != alt)
+				return false;
+			c = r.next ();
+		}
+	}
+
+	if (c >= 0)
+		return false;
+
+	memcpy (out, buf, count);
+	return true;
+}
+
+static boolean parseInt (ValueReader& r, int *out, int min, int max) {
+	int c = r.next ();
+	boolean negative = c == '-';
+	if (negative)
+		c = r.next ();
+
+	long acc = 0;
+	byte digits = 0;
+	for (; c >= '0' && c <= '9'; c = r.next ()) {
+		acc = acc * 10 + (c - '0');
+		if (acc > 32767L)
+			return false;
+		++digits;
+	}
+
+	if (c >= 0 || digits == 0)
+		return false;
+
+	if (negative)
+		acc = -acc;
+	if (acc < min || acc > max)
+		return false;
+
+	*out = acc;
+	return true;
+}
+
+// Reads the whole value into buf, which must hold maxLen + 1 chars
+static boolean readText (ValueReader& r, char *buf, byte maxLen) {
+	byte len = 0;
+
+	for (int c; (c = r.next ()) >= 0; ) {
+		if (len == maxLen)
+			return false;
+		buf[len++] = c;
+	}
+	buf[len] = '\0';
+
+	return true;
+}
+
+static boolean parseChoice (ValueReader& r, byte *out, PGM_P const *choices, byte n) {
+	char buf[PARAM_CHOICE_LEN + 1];
+
+	if (!readText (r, buf, PARAM_CHOICE_LEN))
+		return false;
+
+	for (byte i = 0; i < n; i++) {
+		if (strcmp_P (buf, reinterpret_cast<PGM_P> (pgm_read_ptr (&choices[i]))) == 0) {
+			*out = i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static boolean parseText (ValueReader& r, char *out, int maxLen) {
+	char buf[PARAM_TEXT_LEN + 1];
+
+	if (!readText (r, buf, maxLen < PARAM_TEXT_LEN ? maxLen : PARAM_TEXT_LEN))
+		return false;
+
+	strcpy (out, buf);
+	return true;
+}
+
+// Numbers between min and max (at most 32 apart), separated by commas
+static boolean parseList (ValueReader& r, uint32_t *out, int min, int max) {
+	uint32_t bits = 0;
+	int c = r.next ();
+
+	while (true) {
+		while (c == ' ')
+			c = r.next ();
+
+		int n = 0;
+		byte digits = 0;
+		for (; c >= '0' && c <= '9'; c = r.next ()) {
+			n = n * 10 + (c - '0');
+			if (++digits > 4)
+				return false;
+		}
+
+		if (digits == 0 || n < min || n > max || n - min >= 32)
+			return false;
+		bits |= static_cast<uint32_t> (1) << (n - min);
+
+		while (c == ' ')
+			c = r.next ();
+		if (c < 0)
+			break;
+		else if (c != ',')
+			return false;
+		c = r.next ();
+	}
+
+	*out = bits;
+	return true;
+}
+
+static boolean parseULong (ValueReader& r, unsigned long *out) {
+	uint32_t acc = 0;
+	byte digits = 0;
+	int c;
+
+	for (; (c = r.next ()) >= '0' && c <= '9'; ++digits) {
+		if (acc > (0xFFFFFFFFUL - (c - '0')) / 10)
+			return false;
+		acc = acc * 10 + (c - '0');
+	}
+
+	if (c >= 0 || digits == 0)
+		return false;
+
+	*out = acc;
+	return true;
+}
+
+static boolean parseTime (ValueReader& r, int *out, int min, int max) {
+	int hm[2] = {0, 0};
+	byte digits = 0;
+	int c = r.next ();
+
+	for (byte i = 0; i < 2; i++) {
+		for (digits = 0; c >= '0' && c <= '9'; c = r.next ()) {
+			hm[i] = hm[i] * 10 + (c - '0');
+			if (++digits > 2)
+				return false;
+		}
+
+		if (digits == 0)
+			return false;
+
+		if (i == 0) {
+			if (c != ':')
+				return false;
+			c = r.next ();
+		}
+	}
+
+	int t = hm[0] * 60 + hm[1];
+	if (c >= 0 || hm[1] > 59 || t < min || t > max)
+		return false;
+
+	*out = t;
+	return true;
+}
+
+ParamMask bindQuery (const char *url, const ParamSpec *specs, byte nSpecs, void *dest, ParamMask& errors) {
+	ParamMask found = 0;
+	errors = 0;
+
+	const char *p = strchr (url, '?');
+	if (!p)
+		return found;
+
+	while (*++p) {
+		// Parameter names never need to be encoded
+		const char *name = p;
+		while (*p != '\0' && *p != '=' && *p != '&')
+			++p;
+		byte nameLen = p - name;
+		if (*p == '=')
+			++p;
+
+		ParamSpec spec;
+		byte i;
+		for (i = 0; i < nSpecs; i++) {
+			memcpy_P (&spec, &specs[i], sizeof (spec));
+			if (strlen_P (spec.name) == nameLen && strncmp_P (name, spec.name, nameLen) == 0)
+				break;
+		}
+
+		// Empty values are taken as missing
+		if (i < nSpecs && *p != '\0' && *p != '&') {
+			ValueReader r (p);
+			byte *field = reinterpret_cast<byte *> (dest) + spec.offset;
+			boolean ok;
+
+			switch (spec.type) {
+				case PARAM_INT:
+					ok = parseInt (r, reinterpret_cast<int *> (field), spec.min, spec.max);
+					break;
+				case PARAM_CHOICE:
+					ok = parseChoice (r, field, spec.choices, spec.max);
+					break;
+				case PARAM_IPV4:
+					ok = parseBytes (r, field, 4, 10, '.', '.');
+					break;
+				case PARAM_MAC:
+					ok = parseBytes (r, field, 6, 16, ':', '-');
+					break;
+				case PARAM_TEXT:
+					ok = parseText (r, reinterpret_cast<char *> (field), spec.max);
+					break;
+				case PARAM_LIST:
+					ok = parseList (r, reinterpret_cast<uint32_t *> (field), spec.min, spec.max);
+					break;
+				case PARAM_ULONG:
+					ok = parseULong (r, reinterpret_cast<unsigned long *> (field));
+					break;
+				case PARAM_TIME:
+					ok = parseTime (r, reinterpret_cast<int *> (field), spec.min, spec.max);
+					break;
+				default:
+					ok = true;
+					break;
+			}
+
+			if (ok) {
+				found |= PARAM_BIT (i);
+				errors &= ~PARAM_BIT (i);
+			} else {
+				found &= ~PARAM_BIT (i);
+				errors |= PARAM_BIT (i);
+			}
+		}
+
+		// Skip whatever is left of the value
+		while (*p != '\0' && *p != '&')
+			++p;
+		if (*p == '\0')
+			break;
+	}
+
+	return found;
+}
@@ -0,0 +1,71 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _QUERYBINDER_H_
+#define _QUERYBINDER_H_
+
+#include <Arduino.h>
+
+enum ParamType {
+	PARAM_INT,					// int, between min and max
+	PARAM_CHOICE,				// byte, index of the value in choices
+	PARAM_IPV4,					// byte[4], e.g.: 192.168.1.42
+	PARAM_MAC,					// byte[6], e.g.: 00:11:22:33:44:55
+	PARAM_FLAG,					// Nothing, only tells that it was there
+	PARAM_TEXT,					// char[max + 1], NUL-terminated
+	PARAM_LIST,					// uint32_t, bit n - min set for every n listed, e.g.: 1,3
+	PARAM_ULONG,				// unsigned long, up to 32 bits
+	PARAM_TIME					// int, minutes from midnight, between min and max, e.g.: 8:30
+};
+
+// Longest value accepted for PARAM_CHOICE
+#define PARAM_CHOICE_LEN 8
+
+// Longest value accepted for PARAM_TEXT, whatever max says
+#define PARAM_TEXT_LEN 8
+
+/* Description of a query string parameter and of where to store it, to be
+ * kept in flash in a table passed to bindQuery()
+ */
+struct ParamSpec {
+	PGM_P name;
+	byte type;					// A ParamType
+	byte offset;				// Of the field in the destination struct
+	int min;					// PARAM_INT, PARAM_LIST and PARAM_TIME only
+	int max;					// Same, number of choices for PARAM_CHOICE, length for PARAM_TEXT
+	PGM_P const *choices;		// PARAM_CHOICE only, in flash
+};
+
+// A bit per entry of the table, the first one being the LSB
+typedef uint16_t ParamMask;
+
+#define PARAM_BIT(i) (static_cast<ParamMask> (1) << (i))
+
+/* Parses the query string of url in a single pass, storing the value of every
+ * parameter described in specs into the struct pointed to by dest, which is
+ * only touched for those that are present and valid. Percent-encoding is
+ * decoded on the fly, parameters that are not in the table are ignored and
+ * empty ones are considered missing (as the old code did).
+ *
+ * Returns which parameters were found and valid, while errors gets those that
+ * were found but invalid.
+ */
+ParamMask bindQuery (const char *url, const ParamSpec *specs, byte nSpecs, void *dest, ParamMask& errors);
+
+#endif
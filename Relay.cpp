@@ -22,25 +22,62 @@
 #include "common.h"
 #include "debug.h"
 #include "Relay.h"
+#include "RelayOutput.h"
 
-// FIXME: This can be put to flash only?
-const int Relay::optionAddress[RELAYS_NO] = {
-	EEPROM_R1_PARAM_ADDR,
-	EEPROM_R2_PARAM_ADDR,
-	EEPROM_R3_PARAM_ADDR,
-	EEPROM_R4_PARAM_ADDR
-};
-
-Relay::Relay (byte _id, byte _pin): id (_id), pin (_pin) {
-	//if (_id >= 1 && _id <= RELAYS_NO)
-        pinMode (_pin, OUTPUT);
+static_assert (RELAY_IMAGE_SIZE <= EEPROM_PARAM_SIZE, "Please review the EEPROM offsets in common.h");
+static_assert (EEPROM_R1_PARAM_ADDR + 3 * EEPROM_PARAM_SIZE + RELAY_IMAGE_SIZE <= EEPROM_MAC_ADDR, "The options of relay 4 overlap the MAC address");
+static_assert (RELAY_IMAGE_SCHEDULED + 1 == RELAY_IMAGE_SIZE, "RELAY_IMAGE_SIZE does not match the fields");
+static_assert (sizeof (RelayOptions) == 5, "RelayOptions is not packed as expected");
+
+void packOptions (const RelayOptions& opts, byte *image) {
+	image[RELAY_IMAGE_MODE] = opts.mode;
+	image[RELAY_IMAGE_MODE + 1] = 0;
+	image[RELAY_IMAGE_STATE] = opts.state;
+	image[RELAY_IMAGE_STATE + 1] = 0;
+	image[RELAY_IMAGE_UNITS] = opts.units;
+	image[RELAY_IMAGE_UNITS + 1] = 0;
+	image[RELAY_IMAGE_THRESHOLD] = opts.threshold;
+	image[RELAY_IMAGE_HYSTERESIS] = opts.hysteresis;
+	image[RELAY_IMAGE_DELAY] = opts.delay;
+	image[RELAY_IMAGE_SENSOR] = opts.sensor;
+	image[RELAY_IMAGE_SCHEDULED] = opts.scheduled;
+}
+
+void unpackOptions (const byte *image, RelayOptions& opts) {
+	// Only the low byte of the 2-byte fields ever mattered
+	byte mode = image[RELAY_IMAGE_MODE];
+	opts.mode = mode <= RELMD_SCHEDULE ? static_cast<RelayMode> (mode) : DEFAULT_RELAY_MODE;
+	opts.state = image[RELAY_IMAGE_STATE] == RELAY_ON ? RELAY_ON : RELAY_OFF;
+	opts.units = image[RELAY_IMAGE_UNITS] == TEMP_F ? TEMP_F : TEMP_C;
+	opts.threshold = image[RELAY_IMAGE_THRESHOLD];
+	opts.hysteresis = image[RELAY_IMAGE_HYSTERESIS];
+	opts.delay = image[RELAY_IMAGE_DELAY];
+
+	// Older versions did not save these
+	byte sensor = image[RELAY_IMAGE_SENSOR];
+	opts.sensor = sensor < MAX_SENSORS ? sensor : DEFAULT_RELAY_SENSOR;
+	opts.scheduled = image[RELAY_IMAGE_SCHEDULED] == 1;
+}
+
+Relay::Relay (): id (0) {
+	hysteresisActive = false;
+}
+
+// The first 4 relays come before the network configuration, for historical reasons
+int Relay::optionsAddress () const {
+	if (id <= 4)
+		return EEPROM_R1_PARAM_ADDR + (id - 1) * EEPROM_PARAM_SIZE;
+	else
+		return EEPROM_R5_PARAM_ADDR + (id - 5) * EEPROM_PARAM_SIZE;
 }
 
 void Relay::readOptions () {
-	EEPROM.get (optionAddress[id - 1], static_cast<RelayOptions&> (*this));
+	byte image[RELAY_IMAGE_SIZE];
+
+	for (byte i = 0; i < RELAY_IMAGE_SIZE; i++)
+		image[i] = EEPROM.read (optionsAddress () + i);
+	unpackOptions (image, *this);
 
-	DPRINT (F("sizeof (RelayOptions) = "));
-	DPRINTLN (sizeof (RelayOptions));
 	DPRINT (F("Relay "));
 	DPRINT (id);
 	DPRINT (F(" mode is "));
@@ -52,10 +89,14 @@ void Relay::readOptions () {
 }
 
 void Relay::writeOptions () {
+	byte image[RELAY_IMAGE_SIZE];
+
 	DPRINT (F("Saving options for relay "));
 	DPRINTLN (id);
 
-	EEPROM.put (optionAddress[id - 1], static_cast<RelayOptions&> (*this));
+	packOptions (*this, image);
+	for (byte i = 0; i < RELAY_IMAGE_SIZE; i++)
+		EEPROM.update (optionsAddress () + i, image[i]);
 }
 
 void Relay::setDefaults () {
@@ -65,6 +106,25 @@ void Relay::setDefaults () {
 	units = DEFAULT_RELAY_UNITS;
 	hysteresis = DEFAULT_RELAY_HYSTERESIS;
 	delay = DEFAULT_RELAY_DELAY;
+	sensor = DEFAULT_RELAY_SENSOR;
+	scheduled = false;
+}
+
+void Relay::updateSwitchPoints () {
+	int hyst;
+
+	if (units == TEMP_F) {
+		switchPoint = (threshold * 100L - 3200) * 5 / 9;
+		hyst = hysteresis * 10L * 5 / 9;
+	} else {
+		switchPoint = threshold * 100;
+		hyst = hysteresis * 10;
+	}
+
+	if (mode == RELMD_LT)
+		hysteresisPoint = switchPoint - hyst;
+	else
+		hysteresisPoint = switchPoint + hyst;
 }
 
 void Relay::switchState (RelayState newState) {
@@ -78,9 +138,5 @@ void Relay::switchState (RelayState newState) {
 }
 
 void Relay::effectState () {
-#ifdef RELAYS_ACTIVE_LOW
-	digitalWrite (pin, !state);
-#else
-	digitalWrite (pin, state);
-#endif
+	RelayOutput::set (id - 1, state == RELAY_ON);
 }
@@ -24,19 +24,52 @@
 #include "common.h"
 
 
-class Relay: public RelayOptions {
-	static const int optionAddress[RELAYS_NO];
+/* Layout of the options of a relay in EEPROM, written and read field by field
+ * by packOptions() and unpackOptions(). This matches what older versions got
+ * by copying RelayOptions as a raw struct when built with avr-gcc (i.e. enums
+ * taking 2 bytes, little-endian), so that their options are still read back,
+ * but no longer depends on the compiler.
+ */
+#define RELAY_IMAGE_MODE 0					// 2 bytes
+#define RELAY_IMAGE_STATE 2					// 2 bytes
+#define RELAY_IMAGE_UNITS 4					// 2 bytes
+#define RELAY_IMAGE_THRESHOLD 6
+#define RELAY_IMAGE_HYSTERESIS 7
+#define RELAY_IMAGE_DELAY 8
+#define RELAY_IMAGE_SENSOR 9
+#define RELAY_IMAGE_SCHEDULED 10
+#define RELAY_IMAGE_SIZE 11
+
+void packOptions (const RelayOptions& opts, byte *image);
+
+// Values out of range are replaced with the defaults
+void unpackOptions (const byte *image, RelayOptions& opts);
 
+class Relay: public RelayOptions {
 public:
 	byte id;
-	byte pin;
 
-	Relay (byte _id, byte _pin);
+	/* Temperatures at which the relay switches, in hundredths of degree
+	 * Celsius, whatever the units of the options are. switchPoint is the
+	 * threshold itself, while hysteresisPoint is the threshold moved by the
+	 * hysteresis margin. These must be recomputed through updateSwitchPoints()
+	 * whenever the options change.
+	 */
+	int switchPoint;
+	int hysteresisPoint;
+
+	Relay ();
 
 	void readOptions ();
 	void writeOptions ();
 	void setDefaults ();
+	void updateSwitchPoints ();
+
+	int optionsAddress () const;
 
+	/* These only stage the new state of the pin, which is actually changed
+	 * by RelayOutput::commit().
+	 */
 	void switchState (RelayState newState);
 	void effectState ();
 };
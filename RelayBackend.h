@@ -0,0 +1,40 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _RELAYBACKEND_H_
+#define _RELAYBACKEND_H_
+
+#include <Arduino.h>
+#include "enums.h"
+
+/* Whatever the relays are connected to. Implementations are given the levels
+ * of all the relay pins at once (polarity is already taken care of) and should
+ * write them out with as few bus transactions as possible.
+ */
+class RelayBackend {
+public:
+	/* Must set the outputs to the given levels before enabling them, so that
+	 * relays don't glitch at startup.
+	 */
+	virtual void begin (RelayMask levels) = 0;
+
+	virtual void write (RelayMask levels) = 0;
+};
+
+#endif
@@ -0,0 +1,53 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "common.h"
+
+#ifdef RELAY_BACKEND_74HC595
+
+#include "RelayBackend595.h"
+
+#define N_REGISTERS ((RELAYS_NO + 7) / 8)
+
+RelayBackend595::RelayBackend595 (byte _dataPin, byte _clockPin, byte _latchPin):
+	dataPin (_dataPin), clockPin (_clockPin), latchPin (_latchPin) {
+}
+
+void RelayBackend595::begin (RelayMask levels) {
+	digitalWrite (latchPin, LOW);
+	pinMode (dataPin, OUTPUT);
+	pinMode (clockPin, OUTPUT);
+	pinMode (latchPin, OUTPUT);
+
+	write (levels);
+}
+
+void RelayBackend595::write (RelayMask levels) {
+	/* What is shifted in first ends up in the farthest register, so start
+	 * from the last relays.
+	 */
+	for (int8_t i = N_REGISTERS - 1; i >= 0; i--)
+		shiftOut (dataPin, clockPin, MSBFIRST, static_cast<byte> (levels >> (8 * i)));
+
+	// Outputs only change now, all together
+	digitalWrite (latchPin, HIGH);
+	digitalWrite (latchPin, LOW);
+}
+
+#endif	// RELAY_BACKEND_74HC595
@@ -0,0 +1,41 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _RELAYBACKEND595_H_
+#define _RELAYBACKEND595_H_
+
+#include "RelayBackend.h"
+
+/* Relays connected to a chain of 74HC595 shift registers, 8 relays each. All
+ * the registers are rewritten and latched together at every write.
+ */
+class RelayBackend595: public RelayBackend {
+public:
+	RelayBackend595 (byte _dataPin, byte _clockPin, byte _latchPin);
+
+	void begin (RelayMask levels);
+	void write (RelayMask levels);
+
+private:
+	byte dataPin;
+	byte clockPin;
+	byte latchPin;
+};
+
+#endif
@@ -0,0 +1,140 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "common.h"
+
+#ifdef RELAY_BACKEND_GPIO
+
+#include "RelayBackendGPIO.h"
+
+/* Only to be used in constant expressions: indexing it at runtime would make
+ * the compiler keep a copy in RAM (see relayPin() for that).
+ */
+constexpr byte RELAY_PIN_TABLE[] = {RELAY_PINS};
+
+static_assert (sizeof (RELAY_PIN_TABLE) == RELAYS_NO, "RELAY_PINS must list RELAYS_NO pins");
+
+#if defined (__AVR_ATmega328P__) || defined (__AVR_ATmega168__)
+
+enum Port {
+	PORT_B,
+	PORT_C,
+	PORT_D
+};
+
+// See the pin mapping of the ATmega328 in the Arduino core
+constexpr Port pinPort (byte pin) {
+	return pin < 8 ? PORT_D : (pin < 14 ? PORT_B : PORT_C);
+}
+
+constexpr byte pinBit (byte pin) {
+	return 1 << (pin < 8 ? pin : (pin < 14 ? pin - 8 : pin - 14));
+}
+
+// Bits of a port that are connected to relays
+constexpr byte portMask (Port port, byte i = 0) {
+	return i >= RELAYS_NO ? 0 :
+		(pinPort (RELAY_PIN_TABLE[i]) == port ? pinBit (RELAY_PIN_TABLE[i]) : 0) | portMask (port, i + 1);
+}
+
+static constexpr byte MASK_B = portMask (PORT_B);
+static constexpr byte MASK_C = portMask (PORT_C);
+static constexpr byte MASK_D = portMask (PORT_D);
+
+static_assert (MASK_B != 0 || MASK_C != 0 || MASK_D != 0, "No relay pins found");
+
+/* Translates relay levels to the bits of port P. This is unrolled at compile
+ * time, one relay per instantiation, so that every pin is a constant and only
+ * the relays on P cost a bit test.
+ */
+template <Port P, byte I = 0>
+struct PortBits {
+	static constexpr byte bit () {
+		return pinPort (RELAY_PIN_TABLE[I]) == P ? pinBit (RELAY_PIN_TABLE[I]) : 0;
+	}
+
+	static inline byte get (RelayMask levels) {
+		return (bit () != 0 && ((levels >> I) & 0x01) ? bit () : 0) | PortBits<P, I + 1>::get (levels);
+	}
+};
+
+template <Port P>
+struct PortBits<P, RELAYS_NO> {
+	static inline byte get (RelayMask levels __attribute__ ((unused))) {
+		return 0;
+	}
+};
+
+void RelayBackendGPIO::begin (RelayMask levels) {
+	write (levels);
+
+	DDRB |= MASK_B;
+	DDRC |= MASK_C;
+	DDRD |= MASK_D;
+}
+
+void RelayBackendGPIO::write (RelayMask levels) {
+	byte b = PortBits<PORT_B>::get (levels);
+	byte c = PortBits<PORT_C>::get (levels);
+	byte d = PortBits<PORT_D>::get (levels);
+
+	// Other pins of the same ports might be changed from interrupts
+	byte oldSREG = SREG;
+	cli ();
+	if (MASK_B)
+		PORTB = (PORTB & ~MASK_B) | b;
+	if (MASK_C)
+		PORTC = (PORTC & ~MASK_C) | c;
+	if (MASK_D)
+		PORTD = (PORTD & ~MASK_D) | d;
+	SREG = oldSREG;
+}
+
+#else
+
+// Copy of RELAY_PIN_TABLE for runtime use
+const byte RELAY_PIN_FLASH[] PROGMEM = {RELAY_PINS};
+
+static inline byte relayPin (byte i) {
+	return pgm_read_byte (&RELAY_PIN_FLASH[i]);
+}
+
+void RelayBackendGPIO::begin (RelayMask levels) {
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		digitalWrite (relayPin (i), (levels >> i) & 0x01 ? HIGH : LOW);
+		pinMode (relayPin (i), OUTPUT);
+	}
+
+	last = levels;
+}
+
+void RelayBackendGPIO::write (RelayMask levels) {
+	RelayMask changed = levels ^ last;
+
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		if ((changed >> i) & 0x01)
+			digitalWrite (relayPin (i), (levels >> i) & 0x01 ? HIGH : LOW);
+	}
+
+	last = levels;
+}
+
+#endif
+
+#endif	// RELAY_BACKEND_GPIO
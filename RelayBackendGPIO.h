@@ -0,0 +1,41 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _RELAYBACKENDGPIO_H_
+#define _RELAYBACKENDGPIO_H_
+
+#include "RelayBackend.h"
+
+/* Relays connected to the pins listed in RELAY_PINS.
+ *
+ * On the ATmega328/168 (i.e.: Uno, Duemilanove, DINo, etc.) the pins are
+ * mapped to port registers at compile time, so that all the relays are
+ * switched with a single write per port. On other chips we fall back to
+ * digitalWrite(), only for the pins that changed.
+ */
+class RelayBackendGPIO: public RelayBackend {
+public:
+	void begin (RelayMask levels);
+	void write (RelayMask levels);
+
+private:
+	RelayMask last;
+};
+
+#endif
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "common.h"
+
+#ifdef RELAY_BACKEND_MCP23017
+
+#include <Wire.h>
+#include "RelayBackendMCP23017.h"
+
+#define N_CHIPS ((RELAYS_NO + 15) / 16)
+
+// Registers, with IOCON.BANK = 0 (the default)
+#define MCP_IODIRA 0x00
+#define MCP_OLATA 0x14
+
+RelayBackendMCP23017::RelayBackendMCP23017 (byte _address): address (_address) {
+}
+
+// Writes a register of port A and the following one of port B
+void RelayBackendMCP23017::writeRegisters (byte chip, byte reg, uint16_t value) {
+	Wire.beginTransmission (address + chip);
+	Wire.write (reg);
+	Wire.write (static_cast<byte> (value));
+	Wire.write (static_cast<byte> (value >> 8));
+	Wire.endTransmission ();
+}
+
+void RelayBackendMCP23017::begin (RelayMask levels) {
+	Wire.begin ();
+
+	write (levels);
+
+	// Only the pins that have a relay become outputs
+	for (byte chip = 0; chip < N_CHIPS; chip++) {
+		byte n = min (RELAYS_NO - chip * 16, 16);
+		uint16_t used = n == 16 ? 0xFFFF : (1U << n) - 1;
+		writeRegisters (chip, MCP_IODIRA, ~used);
+	}
+}
+
+void RelayBackendMCP23017::write (RelayMask levels) {
+	for (byte chip = 0; chip < N_CHIPS; chip++)
+		writeRegisters (chip, MCP_OLATA, static_cast<uint16_t> (levels >> (16 * chip)));
+}
+
+#endif	// RELAY_BACKEND_MCP23017
@@ -0,0 +1,42 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _RELAYBACKENDMCP23017_H_
+#define _RELAYBACKENDMCP23017_H_
+
+#include "RelayBackend.h"
+
+/* Relays connected to MCP23017 I2C port expanders with consecutive addresses,
+ * 16 relays each (GPA0-7, then GPB0-7). Every write takes a single I2C
+ * transaction per expander, which updates both of its ports.
+ */
+class RelayBackendMCP23017: public RelayBackend {
+public:
+	RelayBackendMCP23017 (byte _address);
+
+	void begin (RelayMask levels);
+	void write (RelayMask levels);
+
+private:
+	byte address;
+
+	void writeRegisters (byte chip, byte reg, uint16_t value);
+};
+
+#endif
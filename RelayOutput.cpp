@@ -0,0 +1,46 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "RelayOutput.h"
+
+// Relays whose pin must be LOW to turn them on
+#if defined (RELAYS_ACTIVE_LOW)
+	#define ACTIVE_LOW_RELAYS static_cast<RelayMask> (~0UL)
+#elif defined (RELAYS_ACTIVE_LOW_MASK)
+	#define ACTIVE_LOW_RELAYS static_cast<RelayMask> (RELAYS_ACTIVE_LOW_MASK)
+#else
+	#define ACTIVE_LOW_RELAYS 0
+#endif
+
+RelayBackend *RelayOutput::backend = NULL;
+RelayMask RelayOutput::pending = 0;
+RelayMask RelayOutput::committed = 0;
+
+void RelayOutput::begin (RelayBackend& _backend) {
+	backend = &_backend;
+	backend -> begin (pending ^ ACTIVE_LOW_RELAYS);
+	committed = pending;
+}
+
+void RelayOutput::commit () {
+	if (pending != committed && backend) {
+		backend -> write (pending ^ ACTIVE_LOW_RELAYS);
+		committed = pending;
+	}
+}
@@ -0,0 +1,55 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _RELAYOUTPUT_H_
+#define _RELAYOUTPUT_H_
+
+#include <Arduino.h>
+#include "enums.h"
+#include "RelayBackend.h"
+
+/* Keeps track of the state of the relays and sends it to the backend. Changes
+ * are only staged by set() and take effect all together when commit() is
+ * called, so that the backend is accessed at most once per loop().
+ *
+ * Relays are indexed from 0 here.
+ */
+class RelayOutput {
+public:
+	// Call after the initial state of all relays has been set
+	static void begin (RelayBackend& backend);
+
+	static void set (byte index, boolean on) {
+		RelayMask bit = static_cast<RelayMask> (1) << index;
+
+		if (on)
+			pending |= bit;
+		else
+			pending &= ~bit;
+	}
+
+	static void commit ();
+
+private:
+	static RelayBackend *backend;
+	static RelayMask pending;
+	static RelayMask committed;
+};
+
+#endif
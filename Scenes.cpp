@@ -0,0 +1,186 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "common.h"
+
+#ifdef ENABLE_SCENES
+
+#include <EEPROM.h>
+#include "debug.h"
+#include "Crc8.h"
+#include "Scenes.h"
+
+#define SCENE_DATA_SIZE ((RELAYS_NO + 1) / 2)		// A nibble per relay
+#define GROUP_DATA_SIZE ((RELAYS_NO + 7) / 8)		// A bit per relay
+
+static_assert (SCENE_NAME_LEN + SCENE_DATA_SIZE + 1 == EEPROM_SCENE_SIZE, "Please review the EEPROM offsets in common.h");
+static_assert (SCENE_NAME_LEN + GROUP_DATA_SIZE + 1 == EEPROM_GROUP_SIZE, "Please review the EEPROM offsets in common.h");
+static_assert (MAX_SCENES <= GROUP_RECORD_ID - SCENE_RECORD_ID && MAX_GROUPS <= 0x20, "Too many scenes or groups");
+
+static boolean isScene (byte recordId) {
+	return recordId >= SCENE_RECORD_ID && recordId < SCENE_RECORD_ID + MAX_SCENES;
+}
+
+static boolean isGroup (byte recordId) {
+	return recordId >= GROUP_RECORD_ID && recordId < GROUP_RECORD_ID + MAX_GROUPS;
+}
+
+int Scenes::address (byte recordId) {
+	if (isScene (recordId))
+		return EEPROM_SCENES_ADDR + (recordId - SCENE_RECORD_ID) * EEPROM_SCENE_SIZE;
+	else
+		return EEPROM_SCENES_ADDR + MAX_SCENES * EEPROM_SCENE_SIZE + (recordId - GROUP_RECORD_ID) * EEPROM_GROUP_SIZE;
+}
+
+byte Scenes::size (byte recordId) {
+	return isScene (recordId) ? EEPROM_SCENE_SIZE : EEPROM_GROUP_SIZE;
+}
+
+byte Scenes::computeCrc (byte recordId) {
+	byte buf[EEPROM_SCENE_SIZE];		// Groups are never larger
+	int addr = address (recordId);
+	byte len = size (recordId) - 1;
+
+	for (byte i = 0; i < len; i++)
+		buf[i] = EEPROM.read (addr + i);
+
+	return crc8 (buf, len);
+}
+
+void Scenes::seal (byte recordId) {
+	EEPROM.update (address (recordId) + size (recordId) - 1, computeCrc (recordId));
+}
+
+void Scenes::writeName (byte recordId, const char *name) {
+	int addr = address (recordId);
+	byte i;
+
+	// Names end up in web pages, so only allow a few harmless characters
+	for (i = 0; i < SCENE_NAME_LEN && name[i] != '\0'; i++) {
+		char c = name[i];
+		if (!isalnum (c) && c != ' ' && c != '-')
+			c = '_';
+		EEPROM.update (addr + i, c);
+	}
+
+	for (; i < SCENE_NAME_LEN; i++)
+		EEPROM.update (addr + i, '\0');
+}
+
+void Scenes::begin () {
+	for (byte id = SCENE_RECORD_ID; id < GROUP_RECORD_ID + MAX_GROUPS; id++) {
+		if ((isScene (id) || isGroup (id)) && EEPROM.read (address (id) + size (id) - 1) != computeCrc (id)) {
+			DPRINT (F("Clearing invalid scene/group "));
+			DPRINTLN (id, HEX);
+
+			int addr = address (id);
+			for (byte i = 0; i < size (id) - 1; i++)
+				EEPROM.update (addr + i, i >= SCENE_NAME_LEN && isScene (id) ? 0xFF : 0x00);
+			seal (id);
+		}
+	}
+}
+
+void Scenes::format () {
+	// Break all CRCs, begin() will do the rest
+	for (byte id = SCENE_RECORD_ID; id < GROUP_RECORD_ID + MAX_GROUPS; id++) {
+		if (isScene (id) || isGroup (id))
+			EEPROM.update (address (id) + size (id) - 1, computeCrc (id) ^ 0xFF);
+	}
+
+	begin ();
+}
+
+void Scenes::getName (byte recordId, char *buf) {
+	byte i = 0;
+
+	if (isScene (recordId) || isGroup (recordId)) {
+		int addr = address (recordId);
+		for (; i < SCENE_NAME_LEN && (buf[i] = EEPROM.read (addr + i)) != '\0'; i++)
+			;
+	}
+
+	buf[i] = '\0';
+}
+
+byte Scenes::getSceneMode (byte scene, byte relay) {
+	byte mode = SCENE_KEEP;
+
+	if (scene < MAX_SCENES && relay < RELAYS_NO) {
+		byte b = EEPROM.read (address (SCENE_RECORD_ID + scene) + SCENE_NAME_LEN + relay / 2);
+		mode = (relay % 2 == 0 ? b : b >> 4) & 0x0F;
+		if (mode != SCENE_KEEP && mode > RELMD_SCHEDULE)
+			mode = SCENE_KEEP;
+	}
+
+	return mode;
+}
+
+boolean Scenes::isGroupMember (byte group, byte relay) {
+	boolean ret = false;
+
+	if (group < MAX_GROUPS && relay < RELAYS_NO) {
+		byte b = EEPROM.read (address (GROUP_RECORD_ID + group) + SCENE_NAME_LEN + relay / 8);
+		ret = (b >> (relay % 8)) & 0x01;
+	}
+
+	return ret;
+}
+
+void Scenes::saveScene (byte scene, const char *name, const Relay *relays) {
+	byte id = SCENE_RECORD_ID + scene;
+	int addr = address (id) + SCENE_NAME_LEN;
+
+	writeName (id, name);
+	for (byte i = 0; i < RELAYS_NO; i += 2) {
+		byte b = relays[i].mode & 0x0F;
+		b |= (i + 1 < RELAYS_NO ? relays[i + 1].mode : SCENE_KEEP) << 4;
+		EEPROM.update (addr + i / 2, b);
+	}
+
+	seal (id);
+}
+
+void Scenes::saveGroup (byte group, const char *name, RelayMask members) {
+	byte id = GROUP_RECORD_ID + group;
+	int addr = address (id) + SCENE_NAME_LEN;
+
+	writeName (id, name);
+	for (byte i = 0; i < GROUP_DATA_SIZE; i++)
+		EEPROM.update (addr + i, static_cast<byte> (members >> (i * 8)));
+
+	seal (id);
+}
+
+boolean Scenes::isRecordId (byte id) {
+	return isScene (id) || isGroup (id);
+}
+
+byte Scenes::modeFor (byte recordId, byte flags, byte relay) {
+	byte mode = SCENE_KEEP;
+
+	if (isScene (recordId))
+		mode = getSceneMode (recordId - SCENE_RECORD_ID, relay);
+	else if (isGroup (recordId) && isGroupMember (recordId - GROUP_RECORD_ID, relay) && flags <= RELMD_SCHEDULE)
+		mode = flags;
+
+	return mode;
+}
+
+#endif
@@ -0,0 +1,81 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _SCENES_H_
+#define _SCENES_H_
+
+#include <Arduino.h>
+#include "Relay.h"
+
+#define SCENE_NAME_LEN 8
+
+// Mode of the relays a scene leaves alone
+#define SCENE_KEEP 0x0F
+
+// Journal records of scenes and groups have these ids, plus the scene/group index
+#define SCENE_RECORD_ID 0x80
+#define GROUP_RECORD_ID 0xA0
+
+/* Named scenes and groups, kept in EEPROM.
+ *
+ * A scene stores a mode for every relay (or SCENE_KEEP), so that a whole strip
+ * can be reconfigured at once. A group is just a set of relays, which can be
+ * put in the same mode at once. Either way, the outputs are switched with a
+ * single commit and the change is journaled as a single record, which only
+ * refers to the scene or group: this is why the journal must be checkpointed
+ * before a scene or group is redefined.
+ *
+ * Each scene and group is protected by its own CRC, an invalid one is cleared
+ * at boot.
+ */
+class Scenes {
+public:
+	static void begin ();
+
+	static void format ();
+
+	// Copies the NUL-terminated name of a scene or group (by record id) to buf, which must hold SCENE_NAME_LEN + 1 chars
+	static void getName (byte recordId, char *buf);
+
+	static byte getSceneMode (byte scene, byte relay);
+
+	static boolean isGroupMember (byte group, byte relay);
+
+	// Stores the current modes of all relays as a scene
+	static void saveScene (byte scene, const char *name, const Relay *relays);
+
+	static void saveGroup (byte group, const char *name, RelayMask members);
+
+	// Tells whether a journal record id refers to a scene or group
+	static boolean isRecordId (byte id);
+
+	/* Returns the mode the given journal record sets for a relay (0-based), or
+	 * SCENE_KEEP. flags is the mode groups are switched to.
+	 */
+	static byte modeFor (byte recordId, byte flags, byte relay);
+
+private:
+	static int address (byte recordId);
+	static byte size (byte recordId);
+	static byte computeCrc (byte recordId);
+	static void seal (byte recordId);
+	static void writeName (byte recordId, const char *name);
+};
+
+#endif
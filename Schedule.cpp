@@ -0,0 +1,139 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "common.h"
+
+#ifdef ENABLE_SCHEDULE
+
+#include <EEPROM.h>
+#include "debug.h"
+#include "Crc8.h"
+#include "Schedule.h"
+
+#define SCHEDULE_BYTES (SCHEDULE_SIZE - 1)
+
+static_assert (SCHEDULE_SIZE == EEPROM_SCHEDULE_SIZE, "Please review the EEPROM offsets in common.h");
+
+Schedule::Schedule (): address (0), active (false), nextChange (SCHEDULE_NEVER) {
+}
+
+void Schedule::begin (byte relayId, unsigned long t) {
+	address = EEPROM_SCHEDULE_ADDR + (relayId - 1) * SCHEDULE_SIZE;
+
+	// Older versions used this area for other things
+	if (EEPROM.read (address + SCHEDULE_BYTES) != computeCrc ()) {
+		DPRINT (F("Clearing invalid schedule for relay "));
+		DPRINTLN (relayId);
+		clear ();
+	}
+
+	update (t);
+}
+
+byte Schedule::computeCrc () const {
+	byte buf[SCHEDULE_BYTES];
+
+	for (byte i = 0; i < SCHEDULE_BYTES; i++)
+		buf[i] = EEPROM.read (address + i);
+
+	return crc8 (buf, SCHEDULE_BYTES);
+}
+
+void Schedule::seal () {
+	EEPROM.update (address + SCHEDULE_BYTES, computeCrc ());
+}
+
+void Schedule::clear () {
+	for (byte i = 0; i < SCHEDULE_BYTES; i++)
+		EEPROM.update (address + i, 0);
+
+	seal ();
+}
+
+boolean Schedule::set (byte day, int from, int to, boolean on) {
+	byte firstDay, lastDay;
+
+	if (day == SCHEDULE_EVERY_DAY) {
+		firstDay = 0;
+		lastDay = 6;
+	} else if (day == SCHEDULE_WORKDAYS) {
+		firstDay = 1;
+		lastDay = 5;
+	} else if (day < 7) {
+		firstDay = lastDay = day;
+	} else {
+		return false;
+	}
+
+	if (from < 0 || to > 24 * 60)
+		return false;
+
+	// Both ends are rounded down, which must still leave at least one slot
+	unsigned int fromSlot = from / SCHEDULE_SLOT_MINUTES;
+	unsigned int toSlot = to / SCHEDULE_SLOT_MINUTES;
+	if (fromSlot >= toSlot)
+		return false;
+
+	for (byte d = firstDay; d <= lastDay; d++) {
+		unsigned int start = d * SCHEDULE_SLOTS_PER_DAY;
+		for (unsigned int slot = start + fromSlot; slot < start + toSlot; slot++) {
+			int addr = address + slot / 8;
+			byte b = EEPROM.read (addr);
+			if (on)
+				b |= 1 << (slot % 8);
+			else
+				b &= ~(1 << (slot % 8));
+			EEPROM.update (addr, b);
+		}
+	}
+
+	seal ();
+
+	return true;
+}
+
+boolean Schedule::getSlot (unsigned int slot) const {
+	return EEPROM.read (address + slot / 8) & (1 << (slot % 8));
+}
+
+void Schedule::update (unsigned long t) {
+	active = false;
+	nextChange = SCHEDULE_NEVER;
+
+	// Stay off until we know what time it is
+	if (t < SCHEDULE_MIN_TIME)
+		return;
+
+	// 1/1/1970 was a Thursday
+	unsigned long days = t / 86400UL;
+	unsigned int slot = ((days + 4) % 7) * SCHEDULE_SLOTS_PER_DAY + (t % 86400UL) / SCHEDULE_SLOT_SECS;
+	unsigned long slotStart = t - t % SCHEDULE_SLOT_SECS;
+
+	active = getSlot (slot);
+
+	// Find the first slot that differs, if any
+	for (unsigned int n = 1; n < SCHEDULE_SLOTS; n++) {
+		if (getSlot ((slot + n) % SCHEDULE_SLOTS) != active) {
+			nextChange = slotStart + n * SCHEDULE_SLOT_SECS;
+			break;
+		}
+	}
+}
+
+#endif	// ENABLE_SCHEDULE
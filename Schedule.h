@@ -0,0 +1,100 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _SCHEDULE_H_
+#define _SCHEDULE_H_
+
+#include <Arduino.h>
+
+#define SCHEDULE_SLOT_MINUTES 30
+#define SCHEDULE_SLOT_SECS (SCHEDULE_SLOT_MINUTES * 60UL)
+#define SCHEDULE_SLOTS_PER_DAY (24 * 60 / SCHEDULE_SLOT_MINUTES)
+#define SCHEDULE_SLOTS (7 * SCHEDULE_SLOTS_PER_DAY)
+
+// Size of a schedule in EEPROM: one bit per slot, plus a CRC
+#define SCHEDULE_SIZE (SCHEDULE_SLOTS / 8 + 1)
+
+// Special values for the day argument of Schedule::set()
+#define SCHEDULE_EVERY_DAY 7
+#define SCHEDULE_WORKDAYS 8
+
+// Times before this (1/1/2017) mean the clock has not been set yet
+#define SCHEDULE_MIN_TIME 1483228800L
+
+#define SCHEDULE_NEVER 0xFFFFFFFFUL
+
+/* Weekly on/off schedule of a relay, made of slots of SCHEDULE_SLOT_MINUTES,
+ * starting from Sunday at midnight. Days are numbered from 0 (Sunday) to 6.
+ *
+ * The schedule itself only lives in EEPROM, since it is only looked at when
+ * computing the next transition. All that is kept in RAM is whether the
+ * schedule is active now and when that will change, so that keeping up with it
+ * only takes a single comparison. Times are in seconds since 1/1/1970, local
+ * time (i.e.: what now() returns when using the Time library), and are always
+ * passed in by the caller.
+ */
+class Schedule {
+public:
+	Schedule ();
+
+	// Makes sure the schedule in EEPROM is valid, clearing it if it is not
+	void begin (byte relayId, unsigned long t);
+
+	void clear ();
+
+	/* Turns the schedule on or off between two times of the given day(s),
+	 * expressed in minutes from midnight and rounded down to a slot. Returns
+	 * false if the arguments are not valid, including when no slot is left
+	 * between them after rounding.
+	 */
+	boolean set (byte day, int from, int to, boolean on);
+
+	boolean getSlot (unsigned int slot) const;
+
+	boolean isActive () const {
+		return active;
+	}
+
+	unsigned long getNextChange () const {
+		return nextChange;
+	}
+
+	// Must be called whenever the schedule or the clock is changed
+	void update (unsigned long t);
+
+	// Returns true if the schedule has just become active or inactive
+	boolean check (unsigned long t) {
+		if (t < nextChange)
+			return false;
+
+		boolean wasActive = active;
+		update (t);
+		return active != wasActive;
+	}
+
+private:
+	int address;
+	boolean active;
+	unsigned long nextChange;
+
+	byte computeCrc () const;
+	void seal ();
+};
+
+#endif
@@ -0,0 +1,88 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "SipHash.h"
+
+static uint64_t rotl (uint64_t x, byte b) {
+	return (x << b) | (x >> (64 - b));
+}
+
+// Little-endian, as per the specification
+static uint64_t load64 (const byte *p) {
+	uint64_t x = 0;
+
+	for (byte i = 8; i > 0; i--)
+		x = (x << 8) | p[i - 1];
+
+	return x;
+}
+
+static void sipRound (uint64_t v[4]) {
+	v[0] += v[1];
+	v[1] = rotl (v[1], 13);
+	v[1] ^= v[0];
+	v[0] = rotl (v[0], 32);
+	v[2] += v[3];
+	v[3] = rotl (v[3], 16);
+	v[3] ^= v[2];
+	v[0] += v[3];
+	v[3] = rotl (v[3], 21);
+	v[3] ^= v[0];
+	v[2] += v[1];
+	v[1] = rotl (v[1], 17);
+	v[1] ^= v[2];
+	v[2] = rotl (v[2], 32);
+}
+
+void sipHash24 (const byte *key, const byte *data, byte len, byte *out) {
+	uint64_t k0 = load64 (key), k1 = load64 (key + 8);
+	uint64_t v[4] = {
+		k0 ^ 0x736f6d6570736575ULL,
+		k1 ^ 0x646f72616e646f6dULL,
+		k0 ^ 0x6c7967656e657261ULL,
+		k1 ^ 0x7465646279746573ULL
+	};
+
+	byte left = len;
+	for (; left >= 8; left -= 8, data += 8) {
+		uint64_t m = load64 (data);
+		v[3] ^= m;
+		sipRound (v);
+		sipRound (v);
+		v[0] ^= m;
+	}
+
+	// Last block: remaining bytes, with the length in the top byte
+	uint64_t m = static_cast<uint64_t> (len) << 56;
+	for (byte i = 0; i < left; i++)
+		m |= static_cast<uint64_t> (data[i]) << (8 * i);
+
+	v[3] ^= m;
+	sipRound (v);
+	sipRound (v);
+	v[0] ^= m;
+
+	v[2] ^= 0xFF;
+	for (byte i = 0; i < 4; i++)
+		sipRound (v);
+
+	uint64_t h = v[0] ^ v[1] ^ v[2] ^ v[3];
+	for (byte i = 0; i < SIPHASH_SIZE; i++, h >>= 8)
+		out[i] = h & 0xFF;
+}
@@ -0,0 +1,33 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _SIPHASH_H_
+#define _SIPHASH_H_
+
+#include <Arduino.h>
+
+#define SIPHASH_KEY_SIZE 16
+#define SIPHASH_SIZE 8
+
+/* SipHash-2-4, a keyed hash meant for short messages, used to authenticate
+ * them. The 64-bit result is stored in out, least significant byte first.
+ */
+void sipHash24 (const byte *key, const byte *data, byte len, byte *out);
+
+#endif
@@ -21,9 +21,30 @@
 #include <EEPROM.h>
 #include "debug.h"
 #include "Relay.h"
+#include "RelayOutput.h"
+#include "TimerWheel.h"
 #include "enums.h"
 #include "common.h"
 #include "html.h"
+#include "Stats.h"
+#include "Tasks.h"
+#include "Journal.h"
+#include "QueryBinder.h"
+#include "History.h"
+
+#ifdef USE_ARDUINO_TIME_LIBRARY
+#include <TimeLib.h>
+#endif
+
+#ifdef ENABLE_SCHEDULE
+#ifndef USE_ARDUINO_TIME_LIBRARY
+#error "ENABLE_SCHEDULE requires USE_ARDUINO_TIME_LIBRARY"
+#endif
+#include "Schedule.h"
+#endif
+#ifdef ENABLE_SCENES
+#include "Scenes.h"
+#endif
 
 // Instantiate the WebServer
 WebServer webserver;
@@ -59,31 +80,224 @@ WebServer webserver;
 	NetworkInterfaceDigiFi netint;
 #endif
 
+// Instantiate the relay backend defined in common.h
+#if defined (RELAY_BACKEND_GPIO)
+	#include "RelayBackendGPIO.h"
+	RelayBackendGPIO relayBackend;
+#elif defined (RELAY_BACKEND_74HC595)
+	#include "RelayBackend595.h"
+	RelayBackend595 relayBackend (SR_DATA_PIN, SR_CLOCK_PIN, SR_LATCH_PIN);
+#elif defined (RELAY_BACKEND_MCP23017)
+	#include <Wire.h>
+	#include "RelayBackendMCP23017.h"
+	RelayBackendMCP23017 relayBackend (MCP23017_ADDRESS);
+#else
+	#error "Please define a relay backend in common.h"
+#endif
+
+#if defined (ENABLE_MQTT) || defined (ENABLE_UDP)
+	// These go through the same interface as the webserver
+	#if defined (WEBBINO_USE_WIZ5100) || defined (WEBBINO_USE_WIZ5500)
+		#include <Ethernet.h>
+		typedef EthernetClient NetClient;
+		typedef EthernetUDP NetUDP;
+	#elif defined (WEBBINO_USE_WIFI101)
+		#include <WiFiUdp.h>
+		typedef WiFiClient NetClient;
+		typedef WiFiUDP NetUDP;
+	#else
+		#error "MQTT and UDP are only supported on the WIZ5x00 and WiFi101 interfaces"
+	#endif
+#endif
+
+#ifdef ENABLE_MQTT
+	#include "MqttLink.h"
+	NetClient mqttClient;
+	MqttLink mqtt (mqttClient);
+#endif
+
+#ifdef ENABLE_UDP
+	#include "UdpControl.h"
+	NetUDP udpSocket;
+	UdpControl udpControl (udpSocket);
+#endif
+
 #ifdef ENABLE_THERMOMETER
 
-#include <Thermometer.h>
+#include <OneWire.h>
+#include "TempSensor.h"
 
 // Instantiate the thermometer
-Thermometer thermometer;
+TempSensor thermometer (THERMOMETER_PIN);
 
-// Current temperature (Start with average ambient temperature)
-float temperature = 25;
-
-// Time the last temperature request was issued
-unsigned long lastTemperatureRequest = 0;
+// Last reading clients were told about through stateVersion
+TempSnapshot lastTemp;
 #endif
 
 // Other stuff
 byte lastSelectedRelay;
 
-Relay relays[RELAYS_NO] = {
-	Relay (1, RELAY1_PIN),
-	Relay (2, RELAY2_PIN),
-	Relay (3, RELAY3_PIN),
-	Relay (4, RELAY4_PIN)
+/* Pages have one line per relay (see the #repeat directive of tools/html2h.py),
+ * each one starting with #RELAY_NEXT#, which selects the relay that the
+ * following RELAYN_* tags refer to. Page functions must call rewindRelays()
+ * first.
+ */
+byte currentRelay;
+
+inline void rewindRelays () {
+	currentRelay = 0;
+}
+
+#ifdef ENABLE_THERMOMETER
+// Same as above for the lines of the sensors, with #SENSOR_NEXT#
+byte currentSensor;
+#endif
+
+// IDs are assigned in setup()
+Relay relays[RELAYS_NO];
+
+Journal journal;
+
+/* A relay is held in its state for at least its delay (in minutes) after it
+ * last switched, so that e.g. a compressor is not short-cycled. These timers
+ * tell which relays are still being held.
+ */
+TimerWheel relayTimers;
+
+// Relays that wanted to switch while held, and how many times that happened
+RelayMask switchesHeld = 0;
+unsigned long switchesSuppressed = 0;
+
+#ifdef ENABLE_HISTORY
+History history;
+#endif
+
+#ifdef ENABLE_SCHEDULE
+Schedule schedules[RELAYS_NO];
+#endif
+
+// Set whenever the relays need to be checked against their configuration
+boolean relaysNeedUpdate = true;
+
+#ifdef ENABLE_STATS
+// Time spent in a whole loop() iteration and in webserver.loop() only
+TimingStats loopStats;
+TimingStats webStats;
+
+// Number of loop() iterations where relays were/weren't checked
+unsigned long relayUpdates = 0;
+unsigned long relayUpdatesSkipped = 0;
+
+// For /metrics
+LogHistogram loopHistogram;
+unsigned long relaySwitches[RELAYS_NO];
+
+struct PageStats {
+	unsigned long requests;
+	TotalTime time;
+};
+
+PageStats pageStats[HTML_PAGES_NO];
+#endif
+
+/* The work done in loop() is split into tasks, so that a slow page or sensor
+ * can't hold relay control back for long, see TaskScheduler. The webserver has
+ * the lowest priority, as serving a page can take some time.
+ */
+void controlTask ();
+void sensorTask ();
+void persistenceTask ();
+void httpTask ();
+#ifdef ENABLE_MQTT
+void mqttTask ();
+#endif
+#ifdef ENABLE_UDP
+void udpTask ();
+#endif
+
+// Indexes of the tasks that are always there
+#define TASK_CONTROL 0
+#define TASK_SENSOR 1
+#define TASK_PERSISTENCE 2
+#define TASK_HTTP 3
+
+Task tasks[] = {
+	// Function, period (ms), priority, budget (us)
+	{controlTask, 10, 0, 2000UL},
+	{sensorTask, 50, 1, 15000UL},
+	{persistenceTask, 1000, 2, 40000UL},
+	{httpTask, 0, 5, 50000UL},
+#ifdef ENABLE_UDP
+	{udpTask, 2, 3, 5000UL},
+#endif
+#ifdef ENABLE_MQTT
+	{mqttTask, 50, 4, 20000UL},
+#endif
 };
 
-bool relayHysteresis[RELAYS_NO];
+TaskScheduler scheduler (tasks, sizeof (tasks) / sizeof (tasks[0]));
+
+/* Call this whenever something happens that might require a relay to switch:
+ * a new temperature reading, a configuration change, a timer expiring, etc.
+ */
+inline void requestRelayUpdate () {
+	relaysNeedUpdate = true;
+}
+
+void updateRelays ();
+RelayMask relayMask ();
+
+#ifdef ENABLE_THERMOMETER
+/* Switches a temperature relay, unless it is being held after its last switch.
+ * Returns true if it was switched.
+ */
+boolean switchUnlessHeld (byte i, RelayState newState) {
+	RelayMask bit = static_cast<RelayMask> (1) << i;
+
+	if (relayTimers.isPending (i)) {
+		// Count every held switch once, even if updateRelays() keeps trying
+		if (!(switchesHeld & bit)) {
+			switchesHeld |= bit;
+			++switchesSuppressed;
+		}
+
+		return false;
+	}
+
+	relays[i].switchState (newState);
+	return true;
+}
+#endif
+
+// Called when a relay is no longer held, see switchUnlessHeld()
+void relayTimerExpired (byte timer) {
+	switchesHeld &= ~(static_cast<RelayMask> (1) << timer);
+	requestRelayUpdate ();
+}
+
+/* Version of the state of the relays, of the temperature and of the network
+ * configuration. This is incremented whenever any of those changes, so that
+ * clients can poll it (through /api/version or /events) and only reload pages
+ * when it has actually changed. This takes the place of ETags, which Webbino
+ * can't handle (see "Webbino limits" in README).
+ */
+unsigned long stateVersion = 1;
+
+inline void stateChanged () {
+	++stateVersion;
+}
+
+/* Value of stateVersion when each relay and the temperature last changed, so
+ * that /events can tell a client only what changed since the version it last
+ * saw
+ */
+unsigned long relayVersion[RELAYS_NO];
+unsigned long tempVersion = 0;
+
+inline void relayChanged (const Relay& relay) {
+	stateChanged ();
+	relayVersion[relay.id - 1] = stateVersion;
+}
 
 
 #define PSTR_TO_F(s) reinterpret_cast<const __FlashStringHelper *> (s)
@@ -110,6 +324,13 @@ void checkAndFormatEEPROM () {
 			relays[i].setDefaults ();
 			relays[i].writeOptions ();
 		}
+		journal.format ();
+#ifdef ENABLE_SCENES
+		Scenes::format ();
+#endif
+#if defined (ENABLE_UDP) && defined (UDP_KEY)
+		udpControl.format ();
+#endif
 
 		// Network configuration
 		EEPROM.put (EEPROM_MAC_ADDR, DEFAULT_MAC_ADDRESS_B1);
@@ -118,7 +339,7 @@ void checkAndFormatEEPROM () {
 		EEPROM.put (EEPROM_MAC_ADDR + 3, DEFAULT_MAC_ADDRESS_B4);
 		EEPROM.put (EEPROM_MAC_ADDR + 4, DEFAULT_MAC_ADDRESS_B5);
 		EEPROM.put (EEPROM_MAC_ADDR + 5, DEFAULT_MAC_ADDRESS_B6);
-		EEPROM.put (EEPROM_NETMODE_ADDR, DEFAULT_NET_MODE);
+		EEPROM.put (EEPROM_NETMODE_ADDR, static_cast<byte> (DEFAULT_NET_MODE));
 		EEPROM.put (EEPROM_IP_ADDR, DEFAULT_IP_ADDRESS_B1);
 		EEPROM.put (EEPROM_IP_ADDR + 1, DEFAULT_IP_ADDRESS_B2);
 		EEPROM.put (EEPROM_IP_ADDR + 2, DEFAULT_IP_ADDRESS_B3);
@@ -179,299 +400,1092 @@ int my_strtoi (const char *nptr, int base) {
 	return acc;
 }
 
-bool tokenize (const char *str, PGM_P sep, byte *buffer, size_t bufsize, int base) {
-	byte count;
-	bool ret;
+/* Names of the modes as used by the JSON API, indexed by RelayMode */
+const char MODE_ON_STR[] PROGMEM = "on";
+const char MODE_OFF_STR[] PROGMEM = "off";
+const char MODE_GT_STR[] PROGMEM = "gt";
+const char MODE_LT_STR[] PROGMEM = "lt";
+const char MODE_SCHEDULE_STR[] PROGMEM = "sched";
+
+PGM_P const modeNames[] PROGMEM = {
+	MODE_ON_STR,
+	MODE_OFF_STR,
+	MODE_GT_STR,
+	MODE_LT_STR,
+	MODE_SCHEDULE_STR
+};
 
-	count = 0;
-	for (const char *str2 = str; (str2 = strstr_P (str2, sep)); ++str2)
-		++count;
+#define N_MODES (sizeof (modeNames) / sizeof (modeNames[0]))
 
-	if (count != bufsize - 1) {
-		DPRINT (F("Cannot tokenize string: "));
-		DPRINTLN (str);
-		ret = false;
-	} else {
-		for (byte i = 0; i < bufsize; ++i) {
-			buffer[i] = my_strtoi (str, base);
-			str = strstr_P (str, sep) + 1;
-		}
-		ret = true;
+// Modes as a single char (e.g. in scenes.html), also indexed by RelayMode
+const char MODE_CHARS[] PROGMEM = "IOGLS";
+
+// Returns the mode with the given name, or N_MODES if there is none
+byte parseModeName (const char *str) {
+	byte md;
+
+	for (md = 0; md < N_MODES; md++) {
+		if (strcmp_P (str, reinterpret_cast<PGM_P> (pgm_read_ptr (&modeNames[md]))) == 0)
+			break;
 	}
 
-	return ret;
+	return md;
+}
+
+/* Forms are bound through the tables below (see QueryBinder.h). When anything
+ * is invalid, nothing is changed and the FORM_ERR tag tells what was wrong.
+ */
+const ParamSpec *formSpecs;
+byte formSpecsNo;
+ParamMask formErrors;
+
+#define N_ELEMENTS(t) (sizeof (t) / sizeof (t[0]))
+
+inline ParamMask bindForm (HTTPRequestParser& request, const ParamSpec *specs, byte n, void *form) {
+	formSpecs = specs;
+	formSpecsNo = n;
+	return bindQuery (request.url, specs, n, form, formErrors);
 }
 
+const char PARAM_MAC_STR[] PROGMEM = "mac";
+const char PARAM_MODE_STR[] PROGMEM = "mode";
+const char PARAM_IP_STR[] PROGMEM = "ip";
+const char PARAM_MASK_STR[] PROGMEM = "mask";
+const char PARAM_GW_STR[] PROGMEM = "gw";
+
+const char NETMODE_DHCP_STR[] PROGMEM = "dhcp";
+const char NETMODE_STATIC_STR[] PROGMEM = "static";
+
+// Indexed by NetworkMode
+PGM_P const netModeNames[] PROGMEM = {
+	NETMODE_DHCP_STR,
+	NETMODE_STATIC_STR
+};
+
+struct NetForm {
+	byte mac[MAC_SIZE];
+	byte mode;
+	byte ip[IP_SIZE];
+	byte mask[IP_SIZE];
+	byte gw[IP_SIZE];
+};
+
+const ParamSpec netParams[] PROGMEM = {
+	{PARAM_MAC_STR, PARAM_MAC, offsetof (NetForm, mac), 0, 0, NULL},
+	{PARAM_MODE_STR, PARAM_CHOICE, offsetof (NetForm, mode), 0, N_ELEMENTS (netModeNames), netModeNames},
+	{PARAM_IP_STR, PARAM_IPV4, offsetof (NetForm, ip), 0, 0, NULL},
+	{PARAM_MASK_STR, PARAM_IPV4, offsetof (NetForm, mask), 0, 0, NULL},
+	{PARAM_GW_STR, PARAM_IPV4, offsetof (NetForm, gw), 0, 0, NULL}
+};
+
 void netconfig_func (HTTPRequestParser& request) {
-	char *param;
-	byte buf[MAC_SIZE], i;
+	NetForm form;
+	byte i;
 
-	param = request.get_parameter (F("mac"));
-	if (strlen (param) > 0) {
-		if (tokenize (param, PSTR ("%3A"), buf, MAC_SIZE, 16)) {		// ':' gets encoded to "%3A" when submitting the form
-			for (i = 0; i < MAC_SIZE; i++)
-				EEPROM.put (EEPROM_MAC_ADDR + i, buf[i]);
-		}
-	}
+	ParamMask found = bindForm (request, netParams, N_ELEMENTS (netParams), &form);
+	if (formErrors || !found)
+		return;
 
-	param = request.get_parameter (F("mode"));
-	if (strlen (param) > 0) {
-		if (strcmp_P (param, PSTR ("static")) == 0)
-			EEPROM.put (EEPROM_NETMODE_ADDR, NETMODE_STATIC);
-		else
-			EEPROM.put (EEPROM_NETMODE_ADDR, NETMODE_DHCP);
+	if (found & PARAM_BIT (0)) {
+		for (i = 0; i < MAC_SIZE; i++)
+			EEPROM.put (EEPROM_MAC_ADDR + i, form.mac[i]);
 	}
 
-	param = request.get_parameter (F("ip"));
-	if (strlen (param) > 0 && tokenize (param, PSTR ("."), buf, IP_SIZE, 10)) {
-		for (i = 0; i < IP_SIZE; i++)
-			EEPROM.put (EEPROM_IP_ADDR + i, buf[i]);
-	}
+	if (found & PARAM_BIT (1))
+		EEPROM.put (EEPROM_NETMODE_ADDR, form.mode);
 
-	param = request.get_parameter (F("mask"));
-	if (strlen (param) > 0 && tokenize (param, PSTR ("."), buf, IP_SIZE, 10)) {
-		for (i = 0; i < IP_SIZE; i++)
-			EEPROM.put (EEPROM_NETMASK_ADDR + i, buf[i]);
+	for (i = 0; i < IP_SIZE; i++) {
+		if (found & PARAM_BIT (2))
+			EEPROM.put (EEPROM_IP_ADDR + i, form.ip[i]);
+		if (found & PARAM_BIT (3))
+			EEPROM.put (EEPROM_NETMASK_ADDR + i, form.mask[i]);
+		if (found & PARAM_BIT (4))
+			EEPROM.put (EEPROM_GATEWAY_ADDR + i, form.gw[i]);
 	}
 
-	param = request.get_parameter (F("gw"));
-	if (strlen (param) > 0 && tokenize (param, PSTR ("."), buf, IP_SIZE, 10)) {
-		for (i = 0; i < IP_SIZE; i++)
-			EEPROM.put (EEPROM_GATEWAY_ADDR + i, buf[i]);
-	}
+	stateChanged ();
 
 	DPRINTLN (F("Configuration saved"));
 }
 
-void opts_func (HTTPRequestParser& request) {
-	char *param;
+// Must be called whenever the options of a relay have been changed
+void relayOptionsChanged (Relay& relay) {
+	relayChanged (relay);
+	relay.updateSwitchPoints ();
+	journal.markDirty (relay.id);
+	requestRelayUpdate ();
 
-	param = request.get_parameter (F("delay"));
-	if (strlen (param) > 0) {
-		for (byte i = 0; i < RELAYS_NO; i++) {
-			Relay& relay = relays[i];
+#ifdef ENABLE_THERMOMETER
+	// The relay might now be close to switching, get a fresh reading soon
+	thermometer.setInterval (THERMO_MIN_INTERVAL);
+#endif
+}
 
-			relay.delay = atoi (param);
+const char PARAM_DELAY_STR[] PROGMEM = "delay";
+const char PARAM_HYST_STR[] PROGMEM = "hyst";
 
-			param = request.get_parameter (F("hyst"));
-			if (strlen (param) > 0)
-				relay.hysteresis = atoi (param) * 10;
-		}
-	}
-}
+struct OptsForm {
+	int delay;					// Minutes
+	int hyst;					// Degrees
+};
 
-void sck_func (HTTPRequestParser& request) {
-	char *param;
+const ParamSpec optsParams[] PROGMEM = {
+	{PARAM_DELAY_STR, PARAM_INT, offsetof (OptsForm, delay), 0, 255, NULL},
+	{PARAM_HYST_STR, PARAM_INT, offsetof (OptsForm, hyst), 0, 25, NULL}
+};
 
-	param = request.get_parameter (F("rel"));
-	if (strlen (param) > 0) {
-		int relayNo = atoi (param);
-		if (relayNo >= 1 && relayNo <= RELAYS_NO) {
-			/* Save the last selected relay for later. I know this is crap, but...
-			 * See below.
-			 */
-			lastSelectedRelay = relayNo;
-
-			Relay& relay = relays[relayNo - 1];
-
-			param = request.get_parameter (F("mode"));
-			if (strlen (param) > 0) {		// Only do something if we got this parameter
-				if (strcmp_P (param, PSTR ("on")) == 0) {
-					relay.mode = RELMD_ON;
-				} else if (strcmp_P (param, PSTR ("off")) == 0) {
-					relay.mode = RELMD_OFF;
-				} else if (strcmp_P (param, PSTR ("temp")) == 0) {
-					param = request.get_parameter (F("thres"));
-					if (strcmp_P (param, PSTR ("gt")) == 0)
-						relay.mode = RELMD_GT;
-					else
-						relay.mode = RELMD_LT;
-
-					param = request.get_parameter (F("temp"));
-					relay.threshold = atoi (param);
-
-					param = request.get_parameter (F("units"));
-					if (strcmp_P (param, PSTR ("F")) == 0)
-						relay.units = TEMP_F;
-					else
-						relay.units = TEMP_C;
-
-					relayHysteresis[relayNo - 1] = false;
-				}
-			}
-		}
+void opts_func (HTTPRequestParser& request) {
+	OptsForm form;
+
+	ParamMask found = bindForm (request, optsParams, N_ELEMENTS (optsParams), &form);
+	if (formErrors || !found)
+		return;
+
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		Relay& relay = relays[i];
+
+		if (found & PARAM_BIT (0))
+			relay.delay = form.delay;
+		if (found & PARAM_BIT (1))
+			relay.hysteresis = form.hyst * 10;
+
+		relayOptionsChanged (relay);
 	}
 }
 
-const Page aboutPage PROGMEM = {about_html_name, about_html, NULL};
-const Page indexPage PROGMEM = {index_html_name, index_html, NULL};
-const Page leftPage PROGMEM = {left_html_name, left_html, NULL};
-const Page netconfigPage PROGMEM = {net_html_name, net_html, netconfig_func};
-const Page optsPage PROGMEM = {opts_html_name, opts_html, opts_func};
-const Page sckPage PROGMEM = {sck_html_name, sck_html, sck_func};
-const Page welcomePage PROGMEM = {main_html_name, main_html, NULL};
+const char PARAM_REL_STR[] PROGMEM = "rel";
+const char PARAM_ACT_STR[] PROGMEM = "act";
+const char PARAM_THRES_STR[] PROGMEM = "thres";
+const char PARAM_TEMP_STR[] PROGMEM = "temp";
+const char PARAM_UNITS_STR[] PROGMEM = "units";
+const char PARAM_SENSOR_STR[] PROGMEM = "sensor";
+const char PARAM_ONLYSCHED_STR[] PROGMEM = "onlysched";
+
+// Modes as in sck.html, where GT and LT are a single choice
+enum SckMode {
+	SCK_ON,
+	SCK_OFF,
+	SCK_SCHED,
+	SCK_TEMP
+};
 
-const Page* const pages[] PROGMEM = {
-	&aboutPage,
-	&indexPage,
-	&leftPage,
-	&netconfigPage,
-	&optsPage,
-	&sckPage,
-	&welcomePage,
- 	NULL
+const char SCK_TEMP_STR[] PROGMEM = "temp";
+
+PGM_P const sckModeNames[] PROGMEM = {
+	MODE_ON_STR,
+	MODE_OFF_STR,
+	MODE_SCHEDULE_STR,
+	SCK_TEMP_STR
 };
 
+// Indexed by RelayMode - RELMD_GT
+PGM_P const sckThresNames[] PROGMEM = {
+	MODE_GT_STR,
+	MODE_LT_STR
+};
 
-/******************************************************************************
- * DEFINITION OF TAGS                                                         *
- ******************************************************************************/
+const char UNITS_C_STR[] PROGMEM = "C";
+const char UNITS_F_STR[] PROGMEM = "F";
 
-#ifdef ENABLE_TAGS
+// Indexed by TemperatureUnits
+PGM_P const unitsNames[] PROGMEM = {
+	UNITS_C_STR,
+	UNITS_F_STR
+};
 
-#define REP_BUFFER_LEN 32
-char replaceBuffer[REP_BUFFER_LEN];
-PString pBuffer (replaceBuffer, REP_BUFFER_LEN);
+struct SckForm {
+	int rel;
+	byte mode;
+	byte thres;
+	int temp;
+	byte units;
+	int sensor;
+};
 
-const char NOT_AVAIL_STR[] PROGMEM = "N/A";
+#define SCK_PARAM_REL 0
+#define SCK_PARAM_MODE 1
+#define SCK_PARAM_TEMP 3
+#define SCK_PARAM_SENSOR 5
+#define SCK_PARAM_ONLYSCHED 6
+
+const ParamSpec sckParams[] PROGMEM = {
+	{PARAM_REL_STR, PARAM_INT, offsetof (SckForm, rel), 1, RELAYS_NO, NULL},
+	{PARAM_MODE_STR, PARAM_CHOICE, offsetof (SckForm, mode), 0, N_ELEMENTS (sckModeNames), sckModeNames},
+	{PARAM_THRES_STR, PARAM_CHOICE, offsetof (SckForm, thres), 0, N_ELEMENTS (sckThresNames), sckThresNames},
+	{PARAM_TEMP_STR, PARAM_INT, offsetof (SckForm, temp), 0, 255, NULL},
+	{PARAM_UNITS_STR, PARAM_CHOICE, offsetof (SckForm, units), 0, N_ELEMENTS (unitsNames), unitsNames},
+	{PARAM_SENSOR_STR, PARAM_INT, offsetof (SckForm, sensor), 1, MAX_SENSORS, NULL},
+	{PARAM_ONLYSCHED_STR, PARAM_FLAG, 0, 0, 0, NULL}
+};
 
-#ifdef USE_ARDUINO_TIME_LIBRARY
+void sck_func (HTTPRequestParser& request) {
+	SckForm form;
 
-PString& evaluate_time (void *data __attribute__ ((unused))) {
-	int x;
+	// Same as the old defaults, for the values that are not mandatory
+	form.thres = RELMD_LT - RELMD_GT;
+	form.units = TEMP_C;
 
-	time_t t = now ();
+	ParamMask found = bindForm (request, sckParams, N_ELEMENTS (sckParams), &form);
+	if (!(found & PARAM_BIT (SCK_PARAM_REL)))
+		return;
 
-	x = hour (t);
-	if (x < 10)
-		pBuffer.print ('0');
-	pBuffer.print (x);
-	pBuffer.print (':');
+	/* Save the last selected relay for later. I know this is crap, but...
+	 * See below.
+	 */
+	lastSelectedRelay = form.rel;
 
-	x = minute (t);
-	if (x < 10)
-		pBuffer.print ('0');
-	pBuffer.print (x);
-	pBuffer.print (':');
+	// Only do something if we got the mode
+	if (formErrors || !(found & PARAM_BIT (SCK_PARAM_MODE)))
+		return;
 
-	x = second (t);
-	if (x < 10)
-		pBuffer.print ('0');
-	pBuffer.print (x);
+	Relay& relay = relays[form.rel - 1];
+	switch (form.mode) {
+		case SCK_ON:
+			relay.mode = RELMD_ON;
+			break;
+		case SCK_OFF:
+			relay.mode = RELMD_OFF;
+			break;
+		case SCK_SCHED:
+			relay.mode = RELMD_SCHEDULE;
+			break;
+		case SCK_TEMP:
+			relay.mode = static_cast<RelayMode> (RELMD_GT + form.thres);
+			relay.units = static_cast<TemperatureUnits> (form.units);
 
-	return pBuffer;
-}
+			if (found & PARAM_BIT (SCK_PARAM_TEMP))
+				relay.threshold = form.temp;
+			if (found & PARAM_BIT (SCK_PARAM_SENSOR))
+				relay.sensor = form.sensor - 1;
 
-// FIXME
-PString& evaluate_date (void *data __attribute__ ((unused))) {
-	int x;
+			// Unchecked checkboxes are not sent at all
+			relay.scheduled = (found & PARAM_BIT (SCK_PARAM_ONLYSCHED)) != 0;
 
-	time_t t = now ();
+			relay.hysteresisActive = false;
+			break;
+	}
 
-	x = day (t);
-	pBuffer[0] = (x / 10) + '0';
-	pBuffer[1] = (x % 10) + '0';
+	relayOptionsChanged (relay);
+}
 
-	pBuffer[2] = '/';
+#ifdef ENABLE_SCHEDULE
+// Next row of the schedule to be printed by evaluate_schedule_row()
+byte scheduleRow;
 
-	x = month (t);
-	pBuffer[3] = (x / 10) + '0';
-	pBuffer[4] = (x % 10) + '0';
+const char PARAM_DAY_STR[] PROGMEM = "day";
+const char PARAM_FROM_STR[] PROGMEM = "from";
+const char PARAM_TO_STR[] PROGMEM = "to";
 
-	pBuffer[5] = '/';
+const char ACT_CLEAR_STR[] PROGMEM = "clear";
 
-	x = year (t);
-	pBuffer[6] = (x / 1000) + '0';
-	pBuffer[7] = ((x % 1000) / 100) + '0';
-	pBuffer[8] = ((x % 100) / 10) + '0';
-	pBuffer[9] = (x % 10) + '0';
+enum SchedAct {
+	SCHED_ON,
+	SCHED_OFF,
+	SCHED_CLEAR
+};
 
-	pBuffer[10] = '\0';
+// Indexed by SchedAct
+PGM_P const schedActNames[] PROGMEM = {
+	MODE_ON_STR,
+	MODE_OFF_STR,
+	ACT_CLEAR_STR
+};
 
-	return pBuffer;
-}
+struct SchedForm {
+	int rel;
+	byte act;
+	int day;
+	int from;					// Minutes from midnight
+	int to;
+};
 
-#endif	// USE_ARDUINO_TIME_LIBRARY
+#define SCHED_PARAM_REL 0
+#define SCHED_PARAM_ACT 1
+#define SCHED_PARAM_TIMES (PARAM_BIT (2) | PARAM_BIT (3) | PARAM_BIT (4))
 
+const ParamSpec schedParams[] PROGMEM = {
+	{PARAM_REL_STR, PARAM_INT, offsetof (SchedForm, rel), 1, RELAYS_NO, NULL},
+	{PARAM_ACT_STR, PARAM_CHOICE, offsetof (SchedForm, act), 0, N_ELEMENTS (schedActNames), schedActNames},
+	{PARAM_DAY_STR, PARAM_INT, offsetof (SchedForm, day), 0, SCHEDULE_WORKDAYS, NULL},
+	{PARAM_FROM_STR, PARAM_TIME, offsetof (SchedForm, from), 0, 24 * 60, NULL},
+	{PARAM_TO_STR, PARAM_TIME, offsetof (SchedForm, to), 0, 24 * 60, NULL}
+};
 
-/* This is a modified version of the floatToString posted by the Arduino forums
- * user "zitron" at http://www.arduino.cc/cgi-bin/yabb2/YaBB.pl?num=1205038401.
- * This is slimmer than dstrtof() (350 vs. 1700 bytes!) and works well enough
- * for our needs, so here we go!
- *
- * NOTE: Precision is fixed to two digits, which is just what we need.
+/* Changes the schedule of relay "rel". Parameter "act" is either "on" or "off"
+ * to change the schedule between times "from" and "to" (HH:MM) of "day" (0 is
+ * Sunday, SCHEDULE_EVERY_DAY and SCHEDULE_WORKDAYS are also accepted), or
+ * "clear" to clear the whole schedule.
  */
-//~ char *floatToString (double val, char *outstr) {
-	//~ char temp[8];
-	//~ unsigned long frac;
+void sched_func (HTTPRequestParser& request) {
+	SchedForm form;
 
-	//~ temp[0] = '\0';
-	//~ outstr[0] = '\0';
+	scheduleRow = 0;
 
-	//~ if (val < 0.0){
-		//~ strcpy (outstr, "-\0");  //print "-" sign
-		//~ val *= -1;
-	//~ }
+	ParamMask found = bindForm (request, schedParams, N_ELEMENTS (schedParams), &form);
+	if (!(found & PARAM_BIT (SCHED_PARAM_REL)))
+		return;
 
-	//~ val += 0.005;		// Round
+	// See evaluate_relay_onoff_checked()
+	lastSelectedRelay = form.rel;
 
-	//~ strcat (outstr, itoa ((int) val, temp, 10));  //prints the integer part without rounding
-	//~ strcat (outstr, ".\0");		// print the decimal point
+	Schedule& schedule = schedules[form.rel - 1];
 
-	//~ frac = (val - (int) val) * 100;
+	if (formErrors || !(found & PARAM_BIT (SCHED_PARAM_ACT)))
+		return;
 
-	//~ if (frac < 10)
-		//~ strcat (outstr, "0\0");    // print padding zeros
+	if (form.act == SCHED_CLEAR) {
+		schedule.clear ();
+	} else if ((found & SCHED_PARAM_TIMES) != SCHED_PARAM_TIMES ||
+	           !schedule.set (form.day, form.from, form.to, form.act == SCHED_ON)) {
+		return;
+	}
 
-	//~ strcat (outstr, itoa (frac, temp, 10));  // print fraction part
+	schedule.update (now ());
+	stateChanged ();
+	requestRelayUpdate ();
+}
+#endif
 
-	//~ return outstr;
-//~ }
+#ifdef USE_ARDUINO_TIME_LIBRARY
+/* Sets the clock. Parameter "t" is the time in seconds since 1/1/1970 UTC
+ * (i.e.: what "date +%s" prints), "tz" is the offset of the local time zone in
+ * minutes, e.g.: /api/time?t=1500000000&tz=120.
+ */
+struct TimeForm {
+	unsigned long t;
+	int tz;						// Minutes
+};
 
-#ifdef ENABLE_THERMOMETER
-PString& evaluate_temp_deg (void *data __attribute__ ((unused))) {
-	Temperature& temp = thermometer.getTemp ();
-	if (temp.valid)
-		pBuffer.print (temp.celsius, 2);
-	else
-		pBuffer.print (PSTR_TO_F (NOT_AVAIL_STR));
+const char PARAM_T_STR[] PROGMEM = "t";
+const char PARAM_TZ_STR[] PROGMEM = "tz";
 
-	return pBuffer;
-}
+const ParamSpec timeParams[] PROGMEM = {
+	{PARAM_T_STR, PARAM_ULONG, offsetof (TimeForm, t), 0, 0, NULL},
+	{PARAM_TZ_STR, PARAM_INT, offsetof (TimeForm, tz), -12 * 60, 14 * 60, NULL}
+};
 
-PString& evaluate_temp_fahr (void *data __attribute__ ((unused))) {
-	Temperature& temp = thermometer.getTemp ();
-	if (temp.valid)
-		pBuffer.print (temp.toFahrenheit (), 2);
-	else
-		pBuffer.print (PSTR_TO_F (NOT_AVAIL_STR));
+void api_time_func (HTTPRequestParser& request) {
+	TimeForm form;
 
-	return pBuffer;
+	form.tz = 0;
+	ParamMask found = bindForm (request, timeParams, N_ELEMENTS (timeParams), &form);
+	if (formErrors || !(found & PARAM_BIT (0)))
+		return;
+
+	unsigned long t = form.t + form.tz * 60L;
+	setTime (t);
+
+#ifdef ENABLE_SCHEDULE
+	for (byte i = 0; i < RELAYS_NO; i++)
+		schedules[i].update (t);
+	requestRelayUpdate ();
+#endif
 }
 #endif
 
-PString& evaluate_ip (void *data __attribute__ ((unused))) {
- 	pBuffer.print (netint.getIP ());
+#ifdef ENABLE_SCENES
+/* Puts relays in the modes set by a scene or group (see Scenes::modeFor()),
+ * switches them all with a single RelayOutput::commit() and journals the whole
+ * thing as a single record. Returns how many relays changed mode.
+ */
+byte applyScene (byte recordId, byte flags) {
+	RelayMask affected = 0, modified = 0;
+	byte changed = 0;
 
- 	return pBuffer;
-}
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		byte mode = Scenes::modeFor (recordId, flags, i);
+		if (mode != SCENE_KEEP) {
+			Relay& relay = relays[i];
 
-PString& evaluate_netmask (void *data __attribute__ ((unused))) {
-	pBuffer.print (netint.getNetmask ());
+			if (relay.mode != mode) {
+				relay.mode = static_cast<RelayMode> (mode);
+				relay.updateSwitchPoints ();
+				relay.hysteresisActive = false;
+				modified |= static_cast<RelayMask> (1) << i;
+				++changed;
+			}
 
- 	return pBuffer;
-}
+			// All of them, since the record will be replayed on all of them
+			affected |= static_cast<RelayMask> (1) << i;
+		}
+	}
 
-PString& evaluate_gw (void *data __attribute__ ((unused))) {
-	pBuffer.print (netint.getGateway ());
+	if (changed > 0) {
+		journal.saveBulk (recordId, flags, affected);
+		stateChanged ();
+		for (byte i = 0; i < RELAYS_NO; i++)
+			if (modified & (static_cast<RelayMask> (1) << i))
+				relayVersion[i] = stateVersion;
 
- 	return pBuffer;
+		relaysNeedUpdate = false;
+		updateRelays ();
+
+#ifdef ENABLE_THERMOMETER
+		thermometer.setInterval (THERMO_MIN_INTERVAL);
+#endif
+	}
+
+	return changed;
 }
 
-PString& evaluate_mac_addr (void *data __attribute__ ((unused))) {
-	const byte *buf = netint.getMAC ();
+// Next scene and group to be printed, see evaluate_scene_next()
+byte currentScene;
+byte currentGroup;
+
+const char PARAM_SCENE_STR[] PROGMEM = "scene";
+const char PARAM_GROUP_STR[] PROGMEM = "group";
+const char PARAM_NAME_STR[] PROGMEM = "name";
+const char PARAM_MEMBERS_STR[] PROGMEM = "members";
+
+const char ACT_APPLY_STR[] PROGMEM = "apply";
+const char ACT_SAVE_STR[] PROGMEM = "save";
+
+// The modes come first, so that their index is the RelayMode
+PGM_P const scenesActNames[] PROGMEM = {
+	MODE_ON_STR,
+	MODE_OFF_STR,
+	MODE_GT_STR,
+	MODE_LT_STR,
+	MODE_SCHEDULE_STR,
+	ACT_APPLY_STR,
+	ACT_SAVE_STR
+};
 
-	for (byte i = 0; i < 6; i++) {
+#define SCENES_ACT_APPLY N_MODES
+#define SCENES_ACT_SAVE (N_MODES + 1)
+
+struct ScenesForm {
+	int scene;
+	int group;
+	byte act;
+	char name[SCENE_NAME_LEN + 1];
+	uint32_t members;
+};
+
+#define SCENES_PARAM_SCENE 0
+#define SCENES_PARAM_GROUP 1
+#define SCENES_PARAM_ACT 2
+
+const ParamSpec scenesParams[] PROGMEM = {
+	{PARAM_SCENE_STR, PARAM_INT, offsetof (ScenesForm, scene), 1, MAX_SCENES, NULL},
+	{PARAM_GROUP_STR, PARAM_INT, offsetof (ScenesForm, group), 1, MAX_GROUPS, NULL},
+	{PARAM_ACT_STR, PARAM_CHOICE, offsetof (ScenesForm, act), 0, N_ELEMENTS (scenesActNames), scenesActNames},
+	{PARAM_NAME_STR, PARAM_TEXT, offsetof (ScenesForm, name), 0, SCENE_NAME_LEN, NULL},
+	{PARAM_MEMBERS_STR, PARAM_LIST, offsetof (ScenesForm, members), 1, RELAYS_NO, NULL}
+};
+
+/* Handles scene "scene" or group "group" (both starting from 1), depending on
+ * parameter "act":
+ * - "apply" applies the scene;
+ * - one of the modes accepted by /api/relays puts the whole group in that mode;
+ * - "save" stores the current modes of all relays as the scene, or the relays
+ *   listed in "members" (e.g. "1,2,5") as the group, either named "name".
+ */
+void scenes_func (HTTPRequestParser& request) {
+	ScenesForm form;
+
+	currentScene = 0;
+	currentGroup = 0;
+
+	form.name[0] = '\0';
+	form.members = 0;
+	ParamMask found = bindForm (request, scenesParams, N_ELEMENTS (scenesParams), &form);
+	if (formErrors || !(found & PARAM_BIT (SCENES_PARAM_ACT)))
+		return;
+
+	// Both are in range when found, so they can be narrowed to a byte
+	boolean hasScene = found & PARAM_BIT (SCENES_PARAM_SCENE);
+	boolean hasGroup = found & PARAM_BIT (SCENES_PARAM_GROUP);
+
+	if (form.act == SCENES_ACT_SAVE) {
+		if (!hasScene && !hasGroup)
+			return;
+
+		// Existing records might refer to the old definition
+		journal.checkpoint ();
+
+		if (hasGroup)
+			Scenes::saveGroup (form.group - 1, form.name, static_cast<RelayMask> (form.members));
+		else
+			Scenes::saveScene (form.scene - 1, form.name, relays);
+	} else if (form.act == SCENES_ACT_APPLY) {
+		if (hasScene)
+			applyScene (SCENE_RECORD_ID + form.scene - 1, 0);
+	} else if (hasGroup) {
+		applyScene (GROUP_RECORD_ID + form.group - 1, form.act);
+	}
+}
+#endif
+
+// Result of the last /api/relays request
+byte apiChanged = 0;
+byte apiErrors = 0;
+
+#ifdef ENABLE_SCENES
+const char PARAM_GM_STR[] PROGMEM = "gm";
+
+struct ApiScenesForm {
+	int scene;
+	int group;
+	byte gm;
+};
+
+#define API_PARAM_SCENE 0
+#define API_PARAM_GROUP 1
+#define API_PARAM_GM 2
+
+const ParamSpec apiScenesParams[] PROGMEM = {
+	{PARAM_SCENE_STR, PARAM_INT, offsetof (ApiScenesForm, scene), 1, MAX_SCENES, NULL},
+	{PARAM_GROUP_STR, PARAM_INT, offsetof (ApiScenesForm, group), 1, MAX_GROUPS, NULL},
+	{PARAM_GM_STR, PARAM_CHOICE, offsetof (ApiScenesForm, gm), 0, N_MODES, modeNames}
+};
+#endif
+
+/* Builds the name of a per-relay parameter, i.e. <prefix><relay number>. These
+ * are still looked up one by one, since there can be up to 4 * RELAYS_NO of
+ * them, which would not fit in a ParamMask.
+ */
+char *relayParamName (char *buf, char prefix, byte relayNo) {
+	byte i = 0;
+
+	buf[i++] = prefix;
+	if (relayNo >= 10)
+		buf[i++] = '0' + relayNo / 10;
+	buf[i++] = '0' + relayNo % 10;
+	buf[i] = '\0';
+
+	return buf;
+}
+
+/* Changes any number of relays in a single request. For every relay N, the
+ * following parameters are accepted, all optional:
+ * - mN: mode, one of "on", "off", "gt", "lt", "sched";
+ * - tN: temperature threshold;
+ * - uN: temperature units, either "C" or "F";
+ * - sN: temperature sensor to follow, starting from 1.
+ *
+ * For instance: /api/relays?m1=on&m2=off&m3=gt&t3=28&u3=C
+ *
+ * Scenes and groups can be applied with "scene" (starting from 1) and with
+ * "group" plus "gm" (the mode to put the group in). These are applied first.
+ *
+ * The reply reports how many relays were changed and how many parameters were
+ * rejected, followed by the mode and state of all relays.
+ */
+void api_relays_func (HTTPRequestParser& request) {
+	char name[4];
+	char *param;
+
+	apiChanged = 0;
+	apiErrors = 0;
+	rewindRelays ();
+
+#ifdef ENABLE_SCENES
+	ApiScenesForm form;
+
+	ParamMask found = bindForm (request, apiScenesParams, N_ELEMENTS (apiScenesParams), &form);
+	for (byte i = 0; i < N_ELEMENTS (apiScenesParams); i++)
+		if (formErrors & PARAM_BIT (i))
+			++apiErrors;
+
+	if (found & PARAM_BIT (API_PARAM_SCENE))
+		apiChanged += applyScene (SCENE_RECORD_ID + form.scene - 1, 0);
+
+	// The mode only makes sense with the group
+	if (found & PARAM_BIT (API_PARAM_GROUP)) {
+		if (found & PARAM_BIT (API_PARAM_GM))
+			apiChanged += applyScene (GROUP_RECORD_ID + form.group - 1, form.gm);
+		else if (!(formErrors & PARAM_BIT (API_PARAM_GM)))
+			++apiErrors;
+	}
+#endif
+
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		Relay& relay = relays[i];
+		boolean changed = false;
+
+		param = request.get_parameter (relayParamName (name, 'm', relay.id));
+		if (strlen (param) > 0) {
+			byte md = parseModeName (param);
+			if (md < N_MODES) {
+				relay.mode = static_cast<RelayMode> (md);
+				relay.hysteresisActive = false;
+				changed = true;
+			} else {
+				++apiErrors;
+			}
+		}
+
+		param = request.get_parameter (relayParamName (name, 't', relay.id));
+		if (strlen (param) > 0) {
+			// At most 3 digits, so that atoi() can't overflow either
+			int threshold = atoi (param);
+			if (isdigit (param[0]) && strlen (param) <= 3 && threshold <= 255) {
+				relay.threshold = threshold;
+				changed = true;
+			} else {
+				++apiErrors;
+			}
+		}
+
+		param = request.get_parameter (relayParamName (name, 'u', relay.id));
+		if (strlen (param) > 0) {
+			if (strcmp_P (param, PSTR ("C")) == 0) {
+				relay.units = TEMP_C;
+				changed = true;
+			} else if (strcmp_P (param, PSTR ("F")) == 0) {
+				relay.units = TEMP_F;
+				changed = true;
+			} else {
+				++apiErrors;
+			}
+		}
+
+		param = request.get_parameter (relayParamName (name, 's', relay.id));
+		if (strlen (param) > 0) {
+			int sensor = atoi (param);
+			if (sensor >= 1 && sensor <= MAX_SENSORS) {
+				relay.sensor = sensor - 1;
+				changed = true;
+			} else {
+				++apiErrors;
+			}
+		}
+
+		if (changed) {
+			relayOptionsChanged (relay);
+			++apiChanged;
+		}
+	}
+
+	/* Make the reply show the new states: updateRelays() would only be called
+	 * after this page has been sent.
+	 */
+	if (apiChanged > 0) {
+		relaysNeedUpdate = false;
+		updateRelays ();
+	}
+}
+
+#ifdef ENABLE_MQTT
+// Commands take the same mode names as /api/relays
+void mqttCommand (byte relayNo, const char *payload) {
+	byte md = parseModeName (payload);
+	if (md < N_MODES) {
+		Relay& relay = relays[relayNo - 1];
+		relay.mode = static_cast<RelayMode> (md);
+		relay.hysteresisActive = false;
+		relayOptionsChanged (relay);
+	}
+}
+#endif
+
+#ifdef ENABLE_UDP
+/* Applies a SET request all at once, or not at all if any mode is invalid, then
+ * fills in the reply with the state of all relays
+ */
+byte udpRequest (UdpPacket& packet) {
+	byte status = UDP_OK;
+
+	if (packet.command == UDP_CMD_SET) {
+		byte i;
+
+		for (i = 0; i < RELAYS_NO; i++) {
+			byte md = (packet.modes[i / 2] >> (i % 2 * 4)) & 0x0F;
+			if ((packet.mask & (1UL << i)) && md >= N_MODES)
+				status = UDP_BAD_MODE;
+		}
+
+		if (status == UDP_OK) {
+			byte changed = 0;
+
+			for (i = 0; i < RELAYS_NO; i++) {
+				Relay& relay = relays[i];
+				byte md = (packet.modes[i / 2] >> (i % 2 * 4)) & 0x0F;
+				if ((packet.mask & (1UL << i)) && relay.mode != md) {
+					relay.mode = static_cast<RelayMode> (md);
+					relay.hysteresisActive = false;
+					relayOptionsChanged (relay);
+					++changed;
+				}
+			}
+
+			// So that the reply has the new states
+			if (changed > 0) {
+				relaysNeedUpdate = false;
+				updateRelays ();
+			}
+		}
+	}
+
+	packet.mask = relayMask ();
+	packet.stateVersion = stateVersion;
+	memset (packet.modes, 0, sizeof (packet.modes));
+	for (byte i = 0; i < RELAYS_NO; i++)
+		packet.modes[i / 2] |= relays[i].mode << (i % 2 * 4);
+
+	return status;
+}
+#endif
+
+void status_func (HTTPRequestParser& request __attribute__ ((unused))) {
+	rewindRelays ();
+#ifdef ENABLE_THERMOMETER
+	currentSensor = 0;
+#endif
+}
+
+/* /events only lists what changed after version eventsSince, or everything if
+ * that is 0. eventsFirst tells whether a relay has been listed yet, for the
+ * commas.
+ */
+unsigned long eventsSince;
+boolean eventsFirst;
+
+const char PARAM_SINCE_STR[] PROGMEM = "since";
+
+const ParamSpec eventsParams[] PROGMEM = {
+	{PARAM_SINCE_STR, PARAM_ULONG, 0, 0, 0, NULL}
+};
+
+void events_func (HTTPRequestParser& request) {
+	eventsSince = 0;
+	bindForm (request, eventsParams, N_ELEMENTS (eventsParams), &eventsSince);
+
+	// Version from before a reboot, the client needs to start over
+	if (eventsSince > stateVersion)
+		eventsSince = 0;
+
+	eventsFirst = true;
+	rewindRelays ();
+}
+
+inline boolean changedSinceEvents (unsigned long version) {
+	return eventsSince == 0 || version > eventsSince;
+}
+
+#ifdef ENABLE_HISTORY
+void history_func (HTTPRequestParser& request __attribute__ ((unused))) {
+	history.rewind ();
+}
+#endif
+
+#ifdef ENABLE_STATS
+const char PARAM_RESET_STR[] PROGMEM = "reset";
+
+const ParamSpec statsParams[] PROGMEM = {
+	{PARAM_RESET_STR, PARAM_FLAG, 0, 0, 0, NULL}
+};
+
+void stats_func (HTTPRequestParser& request) {
+	if (bindForm (request, statsParams, N_ELEMENTS (statsParams), NULL)) {
+		loopStats.reset ();
+		webStats.reset ();
+		scheduler.resetStats ();
+		loopHistogram.reset ();
+	}
+}
+
+// Next histogram bucket and page to be printed in /metrics
+byte currentBucket;
+byte currentPage;
+
+void metrics_func (HTTPRequestParser& request __attribute__ ((unused))) {
+	rewindRelays ();
+	currentBucket = 0;
+	currentPage = 0;
+}
+#endif
+
+#ifdef ENABLE_STATS
+/* Page served by the current webserver.loop() call, see httpTask(). This is
+ * set by the page functions, which get wrapped by PAGE_FUNC() for this.
+ */
+byte servedPage;
+
+template <byte ID>
+void trackedPage (HTTPRequestParser& request __attribute__ ((unused))) {
+	servedPage = ID;
+}
+
+template <byte ID, void (*FUNC) (HTTPRequestParser& request)>
+void trackedPage (HTTPRequestParser& request) {
+	servedPage = ID;
+	FUNC (request);
+}
+
+#define PAGE_FUNC(id, func) trackedPage<id, func>
+#define NO_PAGE_FUNC(id) trackedPage<id>
+#else
+#define PAGE_FUNC(id, func) func
+#define NO_PAGE_FUNC(id) NULL
+#endif
+
+const Page aboutPage PROGMEM = {about_html_name, about_html, NO_PAGE_FUNC (PAGE_ABOUT_HTML)};
+const Page indexPage PROGMEM = {index_html_name, index_html, NO_PAGE_FUNC (PAGE_INDEX_HTML)};
+const Page leftPage PROGMEM = {left_html_name, left_html, NO_PAGE_FUNC (PAGE_LEFT_HTML)};
+const Page netconfigPage PROGMEM = {net_html_name, net_html, PAGE_FUNC (PAGE_NET_HTML, netconfig_func)};
+const Page optsPage PROGMEM = {opts_html_name, opts_html, PAGE_FUNC (PAGE_OPTS_HTML, opts_func)};
+const Page sckPage PROGMEM = {sck_html_name, sck_html, PAGE_FUNC (PAGE_SCK_HTML, sck_func)};
+const Page welcomePage PROGMEM = {main_html_name, main_html, PAGE_FUNC (PAGE_MAIN_HTML, status_func)};
+const Page apiStatePage PROGMEM = {api_state_name, api_state, PAGE_FUNC (PAGE_API_STATE, status_func)};
+const Page apiRelaysPage PROGMEM = {api_relays_name, api_relays, PAGE_FUNC (PAGE_API_RELAYS, api_relays_func)};
+const Page apiVersionPage PROGMEM = {api_version_name, api_version, NO_PAGE_FUNC (PAGE_API_VERSION)};
+const Page eventsPage PROGMEM = {events_name, events, PAGE_FUNC (PAGE_EVENTS, events_func)};
+#ifdef USE_ARDUINO_TIME_LIBRARY
+const Page apiTimePage PROGMEM = {api_time_name, api_time, PAGE_FUNC (PAGE_API_TIME, api_time_func)};
+#endif
+#ifdef ENABLE_SCHEDULE
+const Page schedPage PROGMEM = {sched_html_name, sched_html, PAGE_FUNC (PAGE_SCHED_HTML, sched_func)};
+#endif
+#ifdef ENABLE_SCENES
+const Page scenesPage PROGMEM = {scenes_html_name, scenes_html, PAGE_FUNC (PAGE_SCENES_HTML, scenes_func)};
+#endif
+#ifdef ENABLE_HISTORY
+const Page historyPage PROGMEM = {history_csv_name, history_csv, PAGE_FUNC (PAGE_HISTORY_CSV, history_func)};
+#endif
+#ifdef ENABLE_STATS
+const Page statsPage PROGMEM = {stats_html_name, stats_html, PAGE_FUNC (PAGE_STATS_HTML, stats_func)};
+const Page metricsPage PROGMEM = {metrics_name, metrics, PAGE_FUNC (PAGE_METRICS, metrics_func)};
+#endif
+
+const Page* const pages[] PROGMEM = {
+	&aboutPage,
+	&indexPage,
+	&leftPage,
+	&netconfigPage,
+	&optsPage,
+	&sckPage,
+	&welcomePage,
+	&apiStatePage,
+	&apiRelaysPage,
+	&apiVersionPage,
+	&eventsPage,
+#ifdef USE_ARDUINO_TIME_LIBRARY
+	&apiTimePage,
+#endif
+#ifdef ENABLE_SCHEDULE
+	&schedPage,
+#endif
+#ifdef ENABLE_SCENES
+	&scenesPage,
+#endif
+#ifdef ENABLE_HISTORY
+	&historyPage,
+#endif
+#ifdef ENABLE_STATS
+	&statsPage,
+	&metricsPage,
+#endif
+ 	NULL
+};
+
+
+/******************************************************************************
+ * DEFINITION OF TAGS                                                         *
+ ******************************************************************************/
+
+#ifdef ENABLE_TAGS
+
+#if RELAYS_NO < 32
+#define REP_BUFFER_LEN 32
+#else
+#define REP_BUFFER_LEN (RELAYS_NO + 1)		// Some tags print a char per relay
+#endif
+char replaceBuffer[REP_BUFFER_LEN];
+PString pBuffer (replaceBuffer, REP_BUFFER_LEN);
+
+const char NOT_AVAIL_STR[] PROGMEM = "N/A";
+
+#ifdef USE_ARDUINO_TIME_LIBRARY
+
+PString& evaluate_time (void *data __attribute__ ((unused))) {
+	int x;
+
+	time_t t = now ();
+
+	x = hour (t);
+	if (x < 10)
+		pBuffer.print ('0');
+	pBuffer.print (x);
+	pBuffer.print (':');
+
+	x = minute (t);
+	if (x < 10)
+		pBuffer.print ('0');
+	pBuffer.print (x);
+	pBuffer.print (':');
+
+	x = second (t);
+	if (x < 10)
+		pBuffer.print ('0');
+	pBuffer.print (x);
+
+	return pBuffer;
+}
+
+PString& evaluate_date (void *data __attribute__ ((unused))) {
+	int x;
+
+	time_t t = now ();
+
+	x = day (t);
+	if (x < 10)
+		pBuffer.print ('0');
+	pBuffer.print (x);
+	pBuffer.print ('/');
+
+	x = month (t);
+	if (x < 10)
+		pBuffer.print ('0');
+	pBuffer.print (x);
+	pBuffer.print ('/');
+
+	pBuffer.print (year (t));
+
+	return pBuffer;
+}
+
+PString& evaluate_time_secs (void *data __attribute__ ((unused))) {
+	pBuffer.print (now ());
+
+	return pBuffer;
+}
+
+#endif	// USE_ARDUINO_TIME_LIBRARY
+
+
+/* This is a modified version of the floatToString posted by the Arduino forums
+ * user "zitron" at http://www.arduino.cc/cgi-bin/yabb2/YaBB.pl?num=1205038401.
+ * This is slimmer than dstrtof() (350 vs. 1700 bytes!) and works well enough
+ * for our needs, so here we go!
+ *
+ * NOTE: Precision is fixed to two digits, which is just what we need.
+ */
+//~ char *floatToString (double val, char *outstr) {
+	//~ char temp[8];
+	//~ unsigned long frac;
+
+	//~ temp[0] = '\0';
+	//~ outstr[0] = '\0';
+
+	//~ if (val < 0.0){
+		//~ strcpy (outstr, "-\0");  //print "-" sign
+		//~ val *= -1;
+	//~ }
+
+	//~ val += 0.005;		// Round
+
+	//~ strcat (outstr, itoa ((int) val, temp, 10));  //prints the integer part without rounding
+	//~ strcat (outstr, ".\0");		// print the decimal point
+
+	//~ frac = (val - (int) val) * 100;
+
+	//~ if (frac < 10)
+		//~ strcat (outstr, "0\0");    // print padding zeros
+
+	//~ strcat (outstr, itoa (frac, temp, 10));  // print fraction part
+
+	//~ return outstr;
+//~ }
+
+#ifdef ENABLE_THERMOMETER
+// Prints a value expressed in hundredths with two decimal digits
+void printHundredths (int x) {
+	if (x < 0) {
+		pBuffer.print ('-');
+		x = -x;
+	}
+
+	pBuffer.print (x / 100);
+	pBuffer.print ('.');
+	x %= 100;
+	if (x < 10)
+		pBuffer.print ('0');
+	pBuffer.print (x);
+}
+
+/* These only look at the last published reading, the sensors are never accessed
+ * while a page is being rendered. data is the index of the sensor.
+ */
+PString& evaluate_temp_deg (void *data) {
+	const TempSnapshot& temp = thermometer.getSnapshot (reinterpret_cast<intptr_t> (data));
+	if (temp.valid)
+		printHundredths (temp.celsius);
+	else
+		pBuffer.print (PSTR_TO_F (NOT_AVAIL_STR));
+
+	return pBuffer;
+}
+
+PString& evaluate_temp_fahr (void *data) {
+	const TempSnapshot& temp = thermometer.getSnapshot (reinterpret_cast<intptr_t> (data));
+	if (temp.valid)
+		printHundredths (temp.toFahrenheit ());
+	else
+		pBuffer.print (PSTR_TO_F (NOT_AVAIL_STR));
+
+	return pBuffer;
+}
+
+PString& evaluate_thermo_interval (void *data __attribute__ ((unused))) {
+	pBuffer.print (thermometer.getInterval ());
+
+	return pBuffer;
+}
+
+PString& evaluate_sensor_id (void *data) {
+	const byte *addr = thermometer.getAddress (reinterpret_cast<intptr_t> (data));
+	if (addr) {
+		for (byte i = 0; i < ROM_SIZE; i++) {
+			if (addr[i] < 16)
+				pBuffer.print ('0');
+			pBuffer.print (addr[i], HEX);
+		}
+	} else {
+		pBuffer.print (PSTR_TO_F (NOT_AVAIL_STR));
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_sensor_next (void *data __attribute__ ((unused))) {
+	currentSensor = currentSensor % MAX_SENSORS + 1;
+
+	return pBuffer;
+}
+
+PString& evaluate_sensorn_temp (void *data __attribute__ ((unused))) {
+	return evaluate_temp_deg (reinterpret_cast<void *> (currentSensor - 1));
+}
+
+PString& evaluate_sensorn_id (void *data __attribute__ ((unused))) {
+	return evaluate_sensor_id (reinterpret_cast<void *> (currentSensor - 1));
+}
+#endif
+
+PString& evaluate_ip (void *data __attribute__ ((unused))) {
+ 	pBuffer.print (netint.getIP ());
+
+ 	return pBuffer;
+}
+
+PString& evaluate_netmask (void *data __attribute__ ((unused))) {
+	pBuffer.print (netint.getNetmask ());
+
+ 	return pBuffer;
+}
+
+PString& evaluate_gw (void *data __attribute__ ((unused))) {
+	pBuffer.print (netint.getGateway ());
+
+ 	return pBuffer;
+}
+
+PString& evaluate_mac_addr (void *data __attribute__ ((unused))) {
+	const byte *buf = netint.getMAC ();
+
+	for (byte i = 0; i < 6; i++) {
 		if (buf[i] < 16)
 			pBuffer.print ('0');
 		pBuffer.print (buf[i], HEX);
@@ -488,8 +1502,8 @@ const char CHECKED_STRING[] PROGMEM = "checked";
 const char SELECTED_STRING[] PROGMEM = "selected=\"true\"";
 
 PString& evaluate_netmode (void *data) {
-	NetworkMode netmode;
-	int checkedMode = reinterpret_cast<int> (data);
+	byte netmode;
+	int checkedMode = reinterpret_cast<intptr_t> (data);
 
 	EEPROM.get (EEPROM_NETMODE_ADDR, netmode);
 
@@ -499,8 +1513,14 @@ PString& evaluate_netmode (void *data) {
 	return pBuffer;
 }
 
-PString& evaluate_relay_status (void *data) {
-	int relayNo = reinterpret_cast<int> (data);
+PString& evaluate_relay_next (void *data __attribute__ ((unused))) {
+	currentRelay = currentRelay % RELAYS_NO + 1;
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_status (void *data __attribute__ ((unused))) {
+	int relayNo = currentRelay;
 	if (relayNo >= 1 && relayNo <= RELAYS_NO) {
 		switch (relays[relayNo - 1].state) {
 			case RELAY_ON:
@@ -517,6 +1537,33 @@ PString& evaluate_relay_status (void *data) {
 	return pBuffer;
 }
 
+PString& evaluate_relay_mode (void *data __attribute__ ((unused))) {
+	int relayNo = currentRelay;
+	if (relayNo >= 1 && relayNo <= RELAYS_NO) {
+		byte md = relays[relayNo - 1].mode;
+		if (md < N_MODES)
+			pBuffer.print (PSTR_TO_F (pgm_read_ptr (&modeNames[md])));
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_threshold (void *data __attribute__ ((unused))) {
+	int relayNo = currentRelay;
+	if (relayNo >= 1 && relayNo <= RELAYS_NO)
+		pBuffer.print (relays[relayNo - 1].threshold);
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_units (void *data __attribute__ ((unused))) {
+	int relayNo = currentRelay;
+	if (relayNo >= 1 && relayNo <= RELAYS_NO)
+		pBuffer.print (relays[relayNo - 1].units == TEMP_F ? 'F' : 'C');
+
+	return pBuffer;
+}
+
 /* OK, this works in a quite crap way, but it's going to work as long as a
  * single instance of the web interface is being used, which is likely our
  * case.
@@ -525,117 +1572,480 @@ PString& evaluate_relay_status (void *data) {
  */
 PString& evaluate_relay_onoff_checked (void *data __attribute__ ((unused))) {
 	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
-		int md = reinterpret_cast<int> (data);			// If we cast to RelayMode it won't compile, nevermind!
+		int md = reinterpret_cast<intptr_t> (data);			// If we cast to RelayMode it won't compile, nevermind!
+		if (relays[lastSelectedRelay - 1].mode == md)
+			pBuffer.print (PSTR_TO_F (CHECKED_STRING));
+	}
+
+	return pBuffer;
+}
+
+
+#ifdef ENABLE_THERMOMETER
+
+PString& evaluate_relay_temp_checked (void *data __attribute__ ((unused))) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
+		if (relays[lastSelectedRelay - 1].mode == RELMD_GT || relays[lastSelectedRelay - 1].mode == RELMD_LT)
+			pBuffer.print (PSTR_TO_F (CHECKED_STRING));
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_temp_gtlt_checked (void *data) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
+		int md = static_cast<RelayMode> (reinterpret_cast<intptr_t> (data));		// ;)
 		if (relays[lastSelectedRelay - 1].mode == md)
 			pBuffer.print (PSTR_TO_F (CHECKED_STRING));
 	}
+	return pBuffer;
+}
+
+PString& evaluate_relay_temp_threshold (void *data __attribute__ ((unused))) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO)
+		pBuffer.print (relays[lastSelectedRelay - 1].threshold);
+
+	return pBuffer;
+}
+
+// Sensors are numbered from 1 on the web interface
+PString& evaluate_relay_temp_sensor (void *data __attribute__ ((unused))) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO)
+		pBuffer.print (relays[lastSelectedRelay - 1].sensor + 1);
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_temp_units_c_checked (void *data __attribute__ ((unused))) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
+		if (relays[lastSelectedRelay - 1].units == TEMP_C)
+			pBuffer.print (PSTR_TO_F (SELECTED_STRING));
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_temp_units_f_checked (void *data __attribute__ ((unused))) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
+		if (relays[lastSelectedRelay - 1].units == TEMP_F)
+			pBuffer.print (PSTR_TO_F (SELECTED_STRING));
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_temp_delay (void *data __attribute__ ((unused))) {
+	// Always use first relay's data
+	pBuffer.print (relays[0].delay);
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_temp_margin (void *data __attribute__ ((unused))) {
+	// Always use first relay's data
+	pBuffer.print (relays[0].hysteresis / 10);
+
+	return pBuffer;
+}
+
+#endif		// ENABLE_THERMOMETER
+
+PString& evaluate_version (void *data __attribute__ ((unused))) {
+	pBuffer.print (PROGRAM_VERSION);
+	return pBuffer;
+}
+
+PString& evaluate_uptime (void *data __attribute__ ((unused))) {
+	unsigned long uptime = millis () / 1000;
+	byte d, h, m, s;
+
+	d = uptime / 86400;
+	uptime %= 86400;
+	h = uptime / 3600;
+	uptime %= 3600;
+	m = uptime / 60;
+	uptime %= 60;
+	s = uptime;
+
+	if (d > 0) {
+		pBuffer.print (d);
+		pBuffer.print (d == 1 ? F(" day, ") : F(" days, "));
+	}
+
+	if (h < 10)
+		pBuffer.print ('0');
+	pBuffer.print (h);
+	pBuffer.print (':');
+	if (m < 10)
+		pBuffer.print ('0');
+	pBuffer.print (m);
+	pBuffer.print (':');
+	if (s < 10)
+		pBuffer.print ('0');
+	pBuffer.print (s);
+
+	return pBuffer;
+}
+
+PString& evaluate_uptime_secs (void *data __attribute__ ((unused))) {
+	pBuffer.print (millis () / 1000);
+
+	return pBuffer;
+}
+
+// Same as evaluate_temp_deg() but prints null when not available
+PString& evaluate_temp_json (void *data __attribute__ ((unused))) {
+#ifdef ENABLE_THERMOMETER
+	const TempSnapshot& temp = thermometer.getSnapshot ();
+	if (temp.valid)
+		printHundredths (temp.celsius);
+	else
+#endif
+		pBuffer.print (F("null"));
+
+	return pBuffer;
+}
+
+/* The following print nothing unless the relay or the temperature changed since
+ * the version the /events client asked about
+ */
+PString& evaluate_relay_event_id (void *data __attribute__ ((unused))) {
+	int relayNo = currentRelay;
+	if (relayNo >= 1 && relayNo <= RELAYS_NO && changedSinceEvents (relayVersion[relayNo - 1])) {
+		if (!eventsFirst)
+			pBuffer.print (',');
+		pBuffer.print ('"');
+		pBuffer.print (relayNo);
+		pBuffer.print (F("\":"));
+		eventsFirst = false;
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_event (void *data __attribute__ ((unused))) {
+	int relayNo = currentRelay;
+	if (relayNo >= 1 && relayNo <= RELAYS_NO && changedSinceEvents (relayVersion[relayNo - 1])) {
+		pBuffer.print (F("{\"mode\":\""));
+		evaluate_relay_mode (NULL);
+		pBuffer.print (F("\",\"state\":\""));
+		evaluate_relay_status (NULL);
+		pBuffer.print (F("\"}"));
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_temp_event (void *data __attribute__ ((unused))) {
+	if (changedSinceEvents (tempVersion)) {
+		pBuffer.print (F(",\"temp\":"));
+		evaluate_temp_json (NULL);
+	}
+
+	return pBuffer;
+}
+
+// Names of the parameters of the last form that were not valid
+/* Names that don't fit in the buffer are only counted, so room for " +N" (a
+ * ParamMask has at most 16 bits) must be left unless it's the last name
+ */
+#define FORM_ERR_MORE_LEN 4
+
+PString& evaluate_form_errors (void *data __attribute__ ((unused))) {
+	if (formErrors) {
+		byte more = 0;
+
+		pBuffer.print (F("Invalid:"));
+		for (byte i = 0; i < formSpecsNo; i++) {
+			if (formErrors & PARAM_BIT (i)) {
+				PGM_P name = reinterpret_cast<PGM_P> (pgm_read_ptr (&formSpecs[i].name));
+				byte reserve = (formErrors >> (i + 1)) ? FORM_ERR_MORE_LEN : 0;
+				if (more == 0 && pBuffer.length () + 1 + strlen_P (name) + reserve < REP_BUFFER_LEN) {
+					pBuffer.print (' ');
+					pBuffer.print (PSTR_TO_F (name));
+				} else {
+					++more;
+				}
+			}
+		}
+
+		if (more > 0) {
+			pBuffer.print (F(" +"));
+			pBuffer.print (more);
+		}
+	}
+
+	return pBuffer;
+}
+
+PString& evaluate_byte (void *data) {
+	pBuffer.print (*reinterpret_cast<byte *> (data));
+
+	return pBuffer;
+}
+
+PString& evaluate_ulong (void *data) {
+	pBuffer.print (*reinterpret_cast<unsigned long *> (data));
+
+	return pBuffer;
+}
+
+#ifdef ENABLE_STATS
+// Prints a duration in seconds, with microsecond resolution
+void printSeconds (unsigned long seconds, unsigned long us) {
+	pBuffer.print (seconds);
+	pBuffer.print ('.');
+	for (unsigned long d = 100000UL; d > 1 && us < d; d /= 10)
+		pBuffer.print ('0');
+	pBuffer.print (us);
+}
+
+// Webbino would take a # in a page as the start of a tag
+PString& evaluate_hash (void *data __attribute__ ((unused))) {
+	pBuffer.print ('#');
+
+	return pBuffer;
+}
+
+PString& evaluate_bucket_next (void *data __attribute__ ((unused))) {
+	currentBucket = currentBucket % STATS_HIST_BUCKETS + 1;
+
+	return pBuffer;
+}
+
+PString& evaluate_bucket_bound (void *data __attribute__ ((unused))) {
+	unsigned long bound = LogHistogram::bound (currentBucket - 1);
+
+	printSeconds (bound / 1000000UL, bound % 1000000UL);
+
+	return pBuffer;
+}
+
+// Buckets are cumulative in Prometheus
+PString& evaluate_bucket_count (void *data __attribute__ ((unused))) {
+	unsigned long n = 0;
+
+	for (byte i = 0; i < currentBucket; i++)
+		n += loopHistogram.buckets[i];
+	pBuffer.print (n);
+
+	return pBuffer;
+}
+
+PString& evaluate_total_time (void *data) {
+	const TotalTime& t = *reinterpret_cast<TotalTime *> (data);
+
+	printSeconds (t.seconds, t.us);
+
+	return pBuffer;
+}
+
+PString& evaluate_page_next (void *data __attribute__ ((unused))) {
+	currentPage = currentPage % HTML_PAGES_NO + 1;
+
+	return pBuffer;
+}
+
+PString& evaluate_page_name (void *data __attribute__ ((unused))) {
+	pBuffer.print (PSTR_TO_F (pgm_read_ptr (&html_page_names[currentPage - 1])));
+
+	return pBuffer;
+}
+
+PString& evaluate_page_requests (void *data __attribute__ ((unused))) {
+	pBuffer.print (pageStats[currentPage - 1].requests);
+
+	return pBuffer;
+}
+
+PString& evaluate_page_time (void *data __attribute__ ((unused))) {
+	const TotalTime& t = pageStats[currentPage - 1].time;
+
+	printSeconds (t.seconds, t.us);
+
+	return pBuffer;
+}
+
+PString& evaluate_page_size (void *data __attribute__ ((unused))) {
+	pBuffer.print (pgm_read_word (&html_page_sizes[currentPage - 1]));
+
+	return pBuffer;
+}
+
+PString& evaluate_relay_switches (void *data __attribute__ ((unused))) {
+	pBuffer.print (relaySwitches[currentRelay - 1]);
+
+	return pBuffer;
+}
+
+PString& evaluate_free_ram_low (void *data __attribute__ ((unused))) {
+	int n = freeRamLowWatermark ();
+
+	if (n < 0)
+		pBuffer.print (F("NaN"));
+	else
+		pBuffer.print (n);
 
 	return pBuffer;
 }
 
-
 #ifdef ENABLE_THERMOMETER
+PString& evaluate_conversion_time (void *data __attribute__ ((unused))) {
+	unsigned long ms = thermometer.conversionTime;
 
-PString& evaluate_relay_temp_checked (void *data __attribute__ ((unused))) {
-	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
-		if (relays[lastSelectedRelay - 1].mode == RELMD_GT || relays[lastSelectedRelay - 1].mode == RELMD_LT)
-			pBuffer.print (PSTR_TO_F (CHECKED_STRING));
-	}
+	printSeconds (ms / 1000, (ms % 1000) * 1000);
 
 	return pBuffer;
 }
+#endif
+
+// Longest run and overruns of a task
+PString& evaluate_task (void *data) {
+	const Task& task = *reinterpret_cast<Task *> (data);
+
+	pBuffer.print (task.maxTime);
+	pBuffer.print ('/');
+	pBuffer.print (task.budget);
+	pBuffer.print (F(" us, "));
+	pBuffer.print (task.overruns);
 
-PString& evaluate_relay_temp_gtlt_checked (void *data) {
-	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
-		int md = static_cast<RelayMode> (reinterpret_cast<int> (data));		// ;)
-		if (relays[lastSelectedRelay - 1].mode == md)
-			pBuffer.print (PSTR_TO_F (CHECKED_STRING));
-	}
 	return pBuffer;
 }
+#endif
 
-PString& evaluate_relay_temp_threshold (void *data __attribute__ ((unused))) {
-	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO)
-		pBuffer.print (relays[lastSelectedRelay - 1].threshold);
+#ifdef ENABLE_HISTORY
+/* Every occurrence of this tag prints the next row of the history, so that it
+ * can be sent without ever being built in memory.
+ */
+PString& evaluate_history (void *data __attribute__ ((unused))) {
+	history.printRow (pBuffer);
 
 	return pBuffer;
 }
+#endif
 
-PString& evaluate_relay_temp_units_c_checked (void *data __attribute__ ((unused))) {
-	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
-		if (relays[lastSelectedRelay - 1].units == TEMP_C)
-			pBuffer.print (PSTR_TO_F (SELECTED_STRING));
+#ifdef ENABLE_SCHEDULE
+const char DAY_NAMES[] PROGMEM = "SunMonTueWedThuFriSat";
+
+void printDayName (byte day) {
+	for (byte i = 0; i < 3; i++)
+		pBuffer.print (static_cast<char> (pgm_read_byte (&DAY_NAMES[day * 3 + i])));
+}
+
+/* Every occurrence of this tag prints half a day of the schedule of the relay
+ * selected in sched_func(), one character per slot. Every day starts on a new
+ * line, with its name.
+ */
+PString& evaluate_schedule_row (void *data __attribute__ ((unused))) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO && scheduleRow < 7 * 2) {
+		const Schedule& schedule = schedules[lastSelectedRelay - 1];
+
+		if (scheduleRow % 2 == 0) {
+			pBuffer.print ('\n');
+			printDayName (scheduleRow / 2);
+			pBuffer.print (' ');
+		}
+
+		unsigned int slot = scheduleRow * (SCHEDULE_SLOTS_PER_DAY / 2);
+		for (byte i = 0; i < SCHEDULE_SLOTS_PER_DAY / 2; i++)
+			pBuffer.print (schedule.getSlot (slot + i) ? '*' : '.');
+
+		++scheduleRow;
 	}
 
 	return pBuffer;
 }
 
-PString& evaluate_relay_temp_units_f_checked (void *data __attribute__ ((unused))) {
+// Tells whether the schedule of the selected relay is active and until when
+PString& evaluate_schedule_next (void *data __attribute__ ((unused))) {
 	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
-		if (relays[lastSelectedRelay - 1].units == TEMP_F)
-			pBuffer.print (PSTR_TO_F (SELECTED_STRING));
+		const Schedule& schedule = schedules[lastSelectedRelay - 1];
+		unsigned long t = schedule.getNextChange ();
+
+		if (now () < SCHEDULE_MIN_TIME) {
+			pBuffer.print (F("Clock not set"));
+		} else {
+			pBuffer.print (schedule.isActive () ? F("ON") : F("OFF"));
+			if (t == SCHEDULE_NEVER) {
+				pBuffer.print (F(" forever"));
+			} else {
+				pBuffer.print (F(" until "));
+				printDayName ((t / 86400UL + 4) % 7);
+				pBuffer.print (' ');
+
+				byte x = hour (t);
+				if (x < 10)
+					pBuffer.print ('0');
+				pBuffer.print (x);
+				pBuffer.print (':');
+				x = minute (t);
+				if (x < 10)
+					pBuffer.print ('0');
+				pBuffer.print (x);
+			}
+		}
 	}
 
 	return pBuffer;
 }
 
-PString& evaluate_relay_temp_delay (void *data __attribute__ ((unused))) {
-	// Always use first relay's data
-	pBuffer.print (relays[0].delay);
+PString& evaluate_relay_onlysched_checked (void *data __attribute__ ((unused))) {
+	if (lastSelectedRelay >= 1 && lastSelectedRelay <= RELAYS_NO) {
+		if (relays[lastSelectedRelay - 1].scheduled)
+			pBuffer.print (PSTR_TO_F (CHECKED_STRING));
+	}
 
 	return pBuffer;
 }
+#endif
 
-PString& evaluate_relay_temp_margin (void *data __attribute__ ((unused))) {
-	// Always use first relay's data
-	pBuffer.print (relays[0].hysteresis / 10);
+#ifdef ENABLE_SCENES
+// Same cursor mechanism as RELAY_NEXT
+PString& evaluate_scene_next (void *data __attribute__ ((unused))) {
+	currentScene = currentScene % MAX_SCENES + 1;
 
 	return pBuffer;
 }
 
-#endif		// ENABLE_THERMOMETER
+PString& evaluate_group_next (void *data __attribute__ ((unused))) {
+	currentGroup = currentGroup % MAX_GROUPS + 1;
 
-PString& evaluate_version (void *data __attribute__ ((unused))) {
-	pBuffer.print (PROGRAM_VERSION);
 	return pBuffer;
 }
 
-PString& evaluate_uptime (void *data __attribute__ ((unused))) {
-	unsigned long uptime = millis () / 1000;
-	byte d, h, m, s;
+// data is either SCENE_RECORD_ID or GROUP_RECORD_ID
+PString& evaluate_scene_name (void *data) {
+	char name[SCENE_NAME_LEN + 1];
+	byte base = reinterpret_cast<intptr_t> (data);
 
-	d = uptime / 86400;
-	uptime %= 86400;
-	h = uptime / 3600;
-	uptime %= 3600;
-	m = uptime / 60;
-	uptime %= 60;
-	s = uptime;
+	Scenes::getName (base + (base == SCENE_RECORD_ID ? currentScene : currentGroup) - 1, name);
+	pBuffer.print (name);
 
-	if (d > 0) {
-		pBuffer.print (d);
-		pBuffer.print (d == 1 ? F(" day, ") : F(" days, "));
+	return pBuffer;
+}
+
+// A char per relay, see the legend in scenes.html
+PString& evaluate_scene_modes (void *data __attribute__ ((unused))) {
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		byte mode = Scenes::getSceneMode (currentScene - 1, i);
+		pBuffer.print (mode == SCENE_KEEP ? '.' : static_cast<char> (pgm_read_byte (&MODE_CHARS[mode])));
 	}
 
-	if (h < 10)
-		pBuffer.print ('0');
-	pBuffer.print (h);
-	pBuffer.print (':');
-	if (m < 10)
-		pBuffer.print ('0');
-	pBuffer.print (m);
-	pBuffer.print (':');
-	if (s < 10)
-		pBuffer.print ('0');
-	pBuffer.print (s);
+	return pBuffer;
+}
+
+PString& evaluate_group_members (void *data __attribute__ ((unused))) {
+	for (byte i = 0; i < RELAYS_NO; i++)
+		pBuffer.print (Scenes::isGroupMember (currentGroup - 1, i) ? 'x' : '.');
 
 	return pBuffer;
 }
+#endif
 
 // See http://playground.arduino.cc/Code/AvailableMemory
 PString& evaluate_free_ram (void *data __attribute__ ((unused))) {
-#ifdef __arm__
-	// We haven't found a reliable way for this on the Due, yet
+#ifndef __AVR__
+	// We haven't found a reliable way for this on the Due (or elsewhere), yet
 	pBuffer.print (F("Unknown"));
 #else
 	extern int __heap_start, *__brkval;
@@ -647,11 +2057,39 @@ PString& evaluate_free_ram (void *data __attribute__ ((unused))) {
 	return pBuffer;
 }
 
+#ifdef ENABLE_STATS
+// Same as above, but Prometheus wants a number
+PString& evaluate_free_ram_num (void *data) {
+#ifdef __AVR__
+	return evaluate_free_ram (data);
+#else
+	pBuffer.print (F("NaN"));
+
+	return pBuffer;
+#endif
+}
+#endif
+
 
 // Max length of these is MAX_TAG_LEN (24)
 #ifdef USE_ARDUINO_TIME_LIBRARY
 const char subDateStr[] PROGMEM = "DATE";
 const char subTimeStr[] PROGMEM = "TIME";
+const char subTimeSecsStr[] PROGMEM = "TIME_S";
+#endif
+#ifdef ENABLE_SCHEDULE
+const char subRelaySchedStr[] PROGMEM = "RELAY_SCHED_CHK";
+const char subRelayOnlySchedStr[] PROGMEM = "RELAY_ONLYSCHED_CHK";
+const char subSchedRowStr[] PROGMEM = "SCHED_ROW";
+const char subSchedNextStr[] PROGMEM = "SCHED_NEXT";
+#endif
+#ifdef ENABLE_SCENES
+const char subSceneNextStr[] PROGMEM = "SCENE_NEXT";
+const char subSceneNameStr[] PROGMEM = "SCENEN_NAME";
+const char subSceneModesStr[] PROGMEM = "SCENEN_MODES";
+const char subGroupNextStr[] PROGMEM = "GROUP_NEXT";
+const char subGroupNameStr[] PROGMEM = "GROUPN_NAME";
+const char subGroupMembersStr[] PROGMEM = "GROUPN_MEMBERS";
 #endif
 const char subMacAddrStr[] PROGMEM = "MACADDR";
 const char subIPAddressStr[] PROGMEM = "NET_IP";
@@ -659,12 +2097,14 @@ const char subNetmaskStr[] PROGMEM = "NET_MASK";
 const char subGatewayStr[] PROGMEM = "NET_GW";
 const char subNMDHCPStr[] PROGMEM = "NETMODE_DHCP_CHK";
 const char subNMStaticStr[] PROGMEM = "NETMODE_STATIC_CHK";
+const char subFormErrorsStr[] PROGMEM = "FORM_ERR";
 const char subRelayOnStr[] PROGMEM = "RELAY_ON_CHK";
 const char subRelayOffStr[] PROGMEM = "RELAY_OFF_CHK";
-const char subRelay1StatusStr[] PROGMEM = "RELAY1_ST";
-const char subRelay2StatusStr[] PROGMEM = "RELAY2_ST";
-const char subRelay3StatusStr[] PROGMEM = "RELAY3_ST";
-const char subRelay4StatusStr[] PROGMEM = "RELAY4_ST";
+const char subRelayNextStr[] PROGMEM = "RELAY_NEXT";
+const char subRelayStatusStr[] PROGMEM = "RELAYN_ST";
+const char subRelayModeStr[] PROGMEM = "RELAYN_MODE";
+const char subRelayThresholdStr[] PROGMEM = "RELAYN_THRES";
+const char subRelayUnitsStr[] PROGMEM = "RELAYN_UNITS";
 #ifdef ENABLE_THERMOMETER
 const char subDegCStr[] PROGMEM = "DEGC";
 const char subDegFStr[] PROGMEM = "DEGF";
@@ -672,6 +2112,13 @@ const char subRelayTempStr[] PROGMEM = "RELAY_TEMP_CHK";
 const char subRelayTempGTStr[] PROGMEM = "RELAY_TGT_CHK";
 const char subRelayTempLTStr[] PROGMEM = "RELAY_TLT_CHK";
 const char subRelayTempThresholdStr[] PROGMEM = "RELAY_THRES";
+const char subSensorNextStr[] PROGMEM = "SENSOR_NEXT";
+const char subSensorTempStr[] PROGMEM = "SENSORN_TEMP";
+const char subSensorIDStr[] PROGMEM = "SENSORN_ID";
+const char subRelayTempSensorStr[] PROGMEM = "RELAY_SENSOR";
+const char subThermoIntervalStr[] PROGMEM = "THERMO_INT";
+const char subThermoRejectedStr[] PROGMEM = "THERMO_REJ";
+const char subThermoCRCErrorsStr[] PROGMEM = "THERMO_CRC";
 const char subRelayTempUnitsCStr[] PROGMEM = "RELAY_TEMPC_CHK";
 const char subRelayTempUnitsFStr[] PROGMEM = "RELAY_TEMPF_CHK";
 const char subRelayTempDelayStr[] PROGMEM = "RELAY_DELAY";
@@ -680,10 +2127,73 @@ const char subRelayTempMarginStr[] PROGMEM = "RELAY_MARGIN";
 const char subVerStr[] PROGMEM = "VERSION";
 const char subUptimeStr[] PROGMEM = "UPTIME";
 const char subFreeRAMStr[] PROGMEM = "FREERAM";
+const char subUptimeSecsStr[] PROGMEM = "UPTIME_S";
+const char subDegCJSONStr[] PROGMEM = "DEGC_JSON";
+const char subAPIChangedStr[] PROGMEM = "API_CHANGED";
+const char subAPIErrorsStr[] PROGMEM = "API_ERRORS";
+const char subStateVersionStr[] PROGMEM = "STATE_VER";
+const char subRelayEventIDStr[] PROGMEM = "RELAYN_EVID";
+const char subRelayEventStr[] PROGMEM = "RELAYN_EV";
+const char subTempEventStr[] PROGMEM = "TEMP_EV";
+#ifdef ENABLE_HISTORY
+const char subHistoryStr[] PROGMEM = "HIST";
+#endif
+#ifdef ENABLE_STATS
+const char subLoopCountStr[] PROGMEM = "LOOP_CNT";
+const char subLoopLastStr[] PROGMEM = "LOOP_LAST";
+const char subLoopAvgStr[] PROGMEM = "LOOP_AVG";
+const char subLoopMaxStr[] PROGMEM = "LOOP_MAX";
+const char subWebLastStr[] PROGMEM = "WEB_LAST";
+const char subWebAvgStr[] PROGMEM = "WEB_AVG";
+const char subWebMaxStr[] PROGMEM = "WEB_MAX";
+const char subRelayUpdatesStr[] PROGMEM = "RELUPD";
+const char subRelayUpdatesSkippedStr[] PROGMEM = "RELUPD_SKIP";
+const char subEEBytesStr[] PROGMEM = "EE_BYTES";
+const char subEERecordsStr[] PROGMEM = "EE_RECS";
+const char subEECoalescedStr[] PROGMEM = "EE_COAL";
+const char subSwitchesSuppressedStr[] PROGMEM = "SW_HELD";
+const char subTaskControlStr[] PROGMEM = "TASK_CTRL";
+const char subTaskSensorStr[] PROGMEM = "TASK_SENS";
+const char subTaskPersistenceStr[] PROGMEM = "TASK_PERS";
+const char subTaskHTTPStr[] PROGMEM = "TASK_HTTP";
+const char subHashStr[] PROGMEM = "HASH";
+const char subBucketNextStr[] PROGMEM = "LOOPH_NEXT";
+const char subBucketBoundStr[] PROGMEM = "LOOPH_LE";
+const char subBucketCountStr[] PROGMEM = "LOOPH_CNT";
+const char subLoopSumStr[] PROGMEM = "LOOPH_SUM";
+const char subLoopTotalStr[] PROGMEM = "LOOPH_TOTAL";
+const char subPageNextStr[] PROGMEM = "PAGE_NEXT";
+const char subPageNameStr[] PROGMEM = "PAGEN_NAME";
+const char subPageRequestsStr[] PROGMEM = "PAGEN_REQS";
+const char subPageTimeStr[] PROGMEM = "PAGEN_TIME";
+const char subPageSizeStr[] PROGMEM = "PAGEN_SIZE";
+const char subRelaySwitchesStr[] PROGMEM = "RELAYN_SW";
+const char subFreeRAMNumStr[] PROGMEM = "FREERAM_NUM";
+const char subFreeRAMLowStr[] PROGMEM = "FREERAM_LOW";
+#ifdef ENABLE_THERMOMETER
+const char subConversionsStr[] PROGMEM = "THERMO_CONV";
+const char subConversionTimeStr[] PROGMEM = "THERMO_CONV_TIME";
+#endif
+#endif
 
 #ifdef USE_ARDUINO_TIME_LIBRARY
 const ReplacementTag subDateVarSub PROGMEM = {subDateStr, evaluate_date, NULL};
 const ReplacementTag subTimeVarSub PROGMEM =	{subTimeStr, evaluate_time, NULL};
+const ReplacementTag subTimeSecsVarSub PROGMEM = {subTimeSecsStr, evaluate_time_secs, NULL};
+#endif
+#ifdef ENABLE_SCHEDULE
+const ReplacementTag subRelaySchedVarSub PROGMEM = {subRelaySchedStr, evaluate_relay_onoff_checked, reinterpret_cast<void *> (RELMD_SCHEDULE)};
+const ReplacementTag subRelayOnlySchedVarSub PROGMEM = {subRelayOnlySchedStr, evaluate_relay_onlysched_checked, NULL};
+const ReplacementTag subSchedRowVarSub PROGMEM = {subSchedRowStr, evaluate_schedule_row, NULL};
+const ReplacementTag subSchedNextVarSub PROGMEM = {subSchedNextStr, evaluate_schedule_next, NULL};
+#endif
+#ifdef ENABLE_SCENES
+const ReplacementTag subSceneNextVarSub PROGMEM = {subSceneNextStr, evaluate_scene_next, NULL};
+const ReplacementTag subSceneNameVarSub PROGMEM = {subSceneNameStr, evaluate_scene_name, reinterpret_cast<void *> (SCENE_RECORD_ID)};
+const ReplacementTag subSceneModesVarSub PROGMEM = {subSceneModesStr, evaluate_scene_modes, NULL};
+const ReplacementTag subGroupNextVarSub PROGMEM = {subGroupNextStr, evaluate_group_next, NULL};
+const ReplacementTag subGroupNameVarSub PROGMEM = {subGroupNameStr, evaluate_scene_name, reinterpret_cast<void *> (GROUP_RECORD_ID)};
+const ReplacementTag subGroupMembersVarSub PROGMEM = {subGroupMembersStr, evaluate_group_members, NULL};
 #endif
 const ReplacementTag subMacAddrVarSub PROGMEM = {subMacAddrStr, evaluate_mac_addr, NULL};
 const ReplacementTag subIPAddressVarSub PROGMEM = {subIPAddressStr, evaluate_ip, NULL};
@@ -691,12 +2201,14 @@ const ReplacementTag subNetmaskVarSub PROGMEM = {subNetmaskStr, evaluate_netmask
 const ReplacementTag subGatewayVarSub PROGMEM = {subGatewayStr, evaluate_gw, NULL};
 const ReplacementTag subNMDHCPVarSub PROGMEM = {subNMDHCPStr, evaluate_netmode, reinterpret_cast<void *> (NETMODE_DHCP)};
 const ReplacementTag subNMStaticVarSub PROGMEM = {subNMStaticStr, evaluate_netmode, reinterpret_cast<void *> (NETMODE_STATIC)};
+const ReplacementTag subFormErrorsVarSub PROGMEM = {subFormErrorsStr, evaluate_form_errors, NULL};
 const ReplacementTag subRelayOnVarSub PROGMEM = {subRelayOnStr, evaluate_relay_onoff_checked, reinterpret_cast<void *> (RELMD_ON)};
 const ReplacementTag subRelayOffVarSub PROGMEM = {subRelayOffStr, evaluate_relay_onoff_checked, reinterpret_cast<void *> (RELMD_OFF)};
-const ReplacementTag subRelay1StatusVarSub PROGMEM = {subRelay1StatusStr, evaluate_relay_status, reinterpret_cast<void *> (1)};
-const ReplacementTag subRelay2StatusVarSub PROGMEM = {subRelay2StatusStr, evaluate_relay_status, reinterpret_cast<void *> (2)};
-const ReplacementTag subRelay3StatusVarSub PROGMEM = {subRelay3StatusStr, evaluate_relay_status, reinterpret_cast<void *> (3)};
-const ReplacementTag subRelay4StatusVarSub PROGMEM = {subRelay4StatusStr, evaluate_relay_status, reinterpret_cast<void *> (4)};
+const ReplacementTag subRelayNextVarSub PROGMEM = {subRelayNextStr, evaluate_relay_next, NULL};
+const ReplacementTag subRelayStatusVarSub PROGMEM = {subRelayStatusStr, evaluate_relay_status, NULL};
+const ReplacementTag subRelayModeVarSub PROGMEM = {subRelayModeStr, evaluate_relay_mode, NULL};
+const ReplacementTag subRelayThresholdVarSub PROGMEM = {subRelayThresholdStr, evaluate_relay_threshold, NULL};
+const ReplacementTag subRelayUnitsVarSub PROGMEM = {subRelayUnitsStr, evaluate_relay_units, NULL};
 #ifdef ENABLE_THERMOMETER
 const ReplacementTag subDegCVarSub PROGMEM = {subDegCStr, evaluate_temp_deg, NULL};
 const ReplacementTag subDegFVarSub PROGMEM = {subDegFStr, evaluate_temp_fahr, NULL};
@@ -704,6 +2216,13 @@ const ReplacementTag subRelayTempVarSub PROGMEM = {subRelayTempStr, evaluate_rel
 const ReplacementTag subRelayTempGTVarSub PROGMEM = {subRelayTempGTStr, evaluate_relay_temp_gtlt_checked, reinterpret_cast<void *> (RELMD_GT)};
 const ReplacementTag subRelayTempLTVarSub PROGMEM = {subRelayTempLTStr, evaluate_relay_temp_gtlt_checked, reinterpret_cast<void *> (RELMD_LT)};
 const ReplacementTag subRelayTempThresholdVarSub PROGMEM = {subRelayTempThresholdStr, evaluate_relay_temp_threshold, NULL};
+const ReplacementTag subSensorNextVarSub PROGMEM = {subSensorNextStr, evaluate_sensor_next, NULL};
+const ReplacementTag subSensorTempVarSub PROGMEM = {subSensorTempStr, evaluate_sensorn_temp, NULL};
+const ReplacementTag subSensorIDVarSub PROGMEM = {subSensorIDStr, evaluate_sensorn_id, NULL};
+const ReplacementTag subRelayTempSensorVarSub PROGMEM = {subRelayTempSensorStr, evaluate_relay_temp_sensor, NULL};
+const ReplacementTag subThermoIntervalVarSub PROGMEM = {subThermoIntervalStr, evaluate_thermo_interval, NULL};
+const ReplacementTag subThermoRejectedVarSub PROGMEM = {subThermoRejectedStr, evaluate_ulong, &thermometer.rejectedReadings};
+const ReplacementTag subThermoCRCErrorsVarSub PROGMEM = {subThermoCRCErrorsStr, evaluate_ulong, &thermometer.crcErrors};
 const ReplacementTag subRelayTempUnitsCVarSub PROGMEM = {subRelayTempUnitsCStr, evaluate_relay_temp_units_c_checked, NULL};
 const ReplacementTag subRelayTempUnitsFVarSub PROGMEM = {subRelayTempUnitsFStr, evaluate_relay_temp_units_f_checked, NULL};
 const ReplacementTag subRelayTempDelayVarSub PROGMEM = {subRelayTempDelayStr, evaluate_relay_temp_delay, NULL};
@@ -712,39 +2231,192 @@ const ReplacementTag subRelayTempMarginVarSub PROGMEM = {subRelayTempMarginStr,
 const ReplacementTag subVerVarSub PROGMEM = {subVerStr, evaluate_version, NULL};
 const ReplacementTag subUptimeVarSub PROGMEM = {subUptimeStr, evaluate_uptime, NULL};
 const ReplacementTag subFreeRAMVarSub PROGMEM = {subFreeRAMStr, evaluate_free_ram, NULL};
+const ReplacementTag subUptimeSecsVarSub PROGMEM = {subUptimeSecsStr, evaluate_uptime_secs, NULL};
+const ReplacementTag subDegCJSONVarSub PROGMEM = {subDegCJSONStr, evaluate_temp_json, NULL};
+const ReplacementTag subAPIChangedVarSub PROGMEM = {subAPIChangedStr, evaluate_byte, &apiChanged};
+const ReplacementTag subAPIErrorsVarSub PROGMEM = {subAPIErrorsStr, evaluate_byte, &apiErrors};
+const ReplacementTag subStateVersionVarSub PROGMEM = {subStateVersionStr, evaluate_ulong, &stateVersion};
+const ReplacementTag subRelayEventIDVarSub PROGMEM = {subRelayEventIDStr, evaluate_relay_event_id, NULL};
+const ReplacementTag subRelayEventVarSub PROGMEM = {subRelayEventStr, evaluate_relay_event, NULL};
+const ReplacementTag subTempEventVarSub PROGMEM = {subTempEventStr, evaluate_temp_event, NULL};
+#ifdef ENABLE_HISTORY
+const ReplacementTag subHistoryVarSub PROGMEM = {subHistoryStr, evaluate_history, NULL};
+#endif
+#ifdef ENABLE_STATS
+const ReplacementTag subLoopCountVarSub PROGMEM = {subLoopCountStr, evaluate_ulong, &loopStats.count};
+const ReplacementTag subLoopLastVarSub PROGMEM = {subLoopLastStr, evaluate_ulong, &loopStats.last};
+const ReplacementTag subLoopAvgVarSub PROGMEM = {subLoopAvgStr, evaluate_ulong, &loopStats.avg};
+const ReplacementTag subLoopMaxVarSub PROGMEM = {subLoopMaxStr, evaluate_ulong, &loopStats.max};
+const ReplacementTag subWebLastVarSub PROGMEM = {subWebLastStr, evaluate_ulong, &webStats.last};
+const ReplacementTag subWebAvgVarSub PROGMEM = {subWebAvgStr, evaluate_ulong, &webStats.avg};
+const ReplacementTag subWebMaxVarSub PROGMEM = {subWebMaxStr, evaluate_ulong, &webStats.max};
+const ReplacementTag subRelayUpdatesVarSub PROGMEM = {subRelayUpdatesStr, evaluate_ulong, &relayUpdates};
+const ReplacementTag subRelayUpdatesSkippedVarSub PROGMEM = {subRelayUpdatesSkippedStr, evaluate_ulong, &relayUpdatesSkipped};
+const ReplacementTag subEEBytesVarSub PROGMEM = {subEEBytesStr, evaluate_ulong, &journal.bytesWritten};
+const ReplacementTag subEERecordsVarSub PROGMEM = {subEERecordsStr, evaluate_ulong, &journal.recordsWritten};
+const ReplacementTag subEECoalescedVarSub PROGMEM = {subEECoalescedStr, evaluate_ulong, &journal.changesCoalesced};
+const ReplacementTag subSwitchesSuppressedVarSub PROGMEM = {subSwitchesSuppressedStr, evaluate_ulong, &switchesSuppressed};
+const ReplacementTag subTaskControlVarSub PROGMEM = {subTaskControlStr, evaluate_task, &tasks[TASK_CONTROL]};
+const ReplacementTag subTaskSensorVarSub PROGMEM = {subTaskSensorStr, evaluate_task, &tasks[TASK_SENSOR]};
+const ReplacementTag subTaskPersistenceVarSub PROGMEM = {subTaskPersistenceStr, evaluate_task, &tasks[TASK_PERSISTENCE]};
+const ReplacementTag subTaskHTTPVarSub PROGMEM = {subTaskHTTPStr, evaluate_task, &tasks[TASK_HTTP]};
+const ReplacementTag subHashVarSub PROGMEM = {subHashStr, evaluate_hash, NULL};
+const ReplacementTag subBucketNextVarSub PROGMEM = {subBucketNextStr, evaluate_bucket_next, NULL};
+const ReplacementTag subBucketBoundVarSub PROGMEM = {subBucketBoundStr, evaluate_bucket_bound, NULL};
+const ReplacementTag subBucketCountVarSub PROGMEM = {subBucketCountStr, evaluate_bucket_count, NULL};
+const ReplacementTag subLoopSumVarSub PROGMEM = {subLoopSumStr, evaluate_total_time, &loopHistogram.total};
+const ReplacementTag subLoopTotalVarSub PROGMEM = {subLoopTotalStr, evaluate_ulong, &loopHistogram.count};
+const ReplacementTag subPageNextVarSub PROGMEM = {subPageNextStr, evaluate_page_next, NULL};
+const ReplacementTag subPageNameVarSub PROGMEM = {subPageNameStr, evaluate_page_name, NULL};
+const ReplacementTag subPageRequestsVarSub PROGMEM = {subPageRequestsStr, evaluate_page_requests, NULL};
+const ReplacementTag subPageTimeVarSub PROGMEM = {subPageTimeStr, evaluate_page_time, NULL};
+const ReplacementTag subPageSizeVarSub PROGMEM = {subPageSizeStr, evaluate_page_size, NULL};
+const ReplacementTag subRelaySwitchesVarSub PROGMEM = {subRelaySwitchesStr, evaluate_relay_switches, NULL};
+const ReplacementTag subFreeRAMNumVarSub PROGMEM = {subFreeRAMNumStr, evaluate_free_ram_num, NULL};
+const ReplacementTag subFreeRAMLowVarSub PROGMEM = {subFreeRAMLowStr, evaluate_free_ram_low, NULL};
+#ifdef ENABLE_THERMOMETER
+const ReplacementTag subConversionsVarSub PROGMEM = {subConversionsStr, evaluate_ulong, &thermometer.conversions};
+const ReplacementTag subConversionTimeVarSub PROGMEM = {subConversionTimeStr, evaluate_conversion_time, NULL};
+#endif
+#endif
 
+/* Webbino looks tags up by scanning this table from the top and comparing
+ * names, there is no way to give it a hashed or sorted index instead (see
+ * "Webbino limits" in README). So the order matters: tags on the pages that get loaded the most
+ * (i.e. /events, which clients poll, and the status page, which is likely to
+ * be refreshed periodically) come first, in the order they appear on the
+ * page, followed by those on the socket page and then by the rest.
+ */
 const ReplacementTag * const substitutions[] PROGMEM = {
-#ifdef USE_ARDUINO_TIME_LIBRARY
-	&subDateVarSub,
-	&subTimeVarSub,
+	// events
+	&subStateVersionVarSub,
+	&subRelayNextVarSub,
+	&subRelayEventIDVarSub,
+	&subRelayEventVarSub,
+	&subTempEventVarSub,
+
+	// main.html
+	&subVerVarSub,
+	&subRelayStatusVarSub,
+	&subFreeRAMVarSub,
+	&subUptimeVarSub,
+#ifdef ENABLE_THERMOMETER
+	&subDegCVarSub,
+	&subDegFVarSub,
+	&subSensorNextVarSub,
+	&subSensorTempVarSub,
+	&subSensorIDVarSub,
 #endif
-	&subMacAddrVarSub,
-	&subIPAddressVarSub,
-	&subNetmaskVarSub,
-	&subGatewayVarSub,
-	&subNMDHCPVarSub,
-	&subNMStaticVarSub,
+
+	// api/state and api/relays
+	&subRelayModeVarSub,
+	&subRelayThresholdVarSub,
+	&subRelayUnitsVarSub,
+	&subUptimeSecsVarSub,
+	&subDegCJSONVarSub,
+	&subAPIChangedVarSub,
+	&subAPIErrorsVarSub,
+#ifdef ENABLE_HISTORY
+	&subHistoryVarSub,
+#endif
+
+	// sck.html
+	&subFormErrorsVarSub,
 	&subRelayOnVarSub,
 	&subRelayOffVarSub,
-	&subRelay1StatusVarSub,
-	&subRelay2StatusVarSub,
-	&subRelay3StatusVarSub,
-	&subRelay4StatusVarSub,
+#ifdef ENABLE_SCHEDULE
+	&subRelaySchedVarSub,
+#endif
 #ifdef ENABLE_THERMOMETER
-	&subDegCVarSub,
-	&subDegFVarSub,
 	&subRelayTempVarSub,
 	&subRelayTempGTVarSub,
 	&subRelayTempLTVarSub,
 	&subRelayTempThresholdVarSub,
+	&subRelayTempSensorVarSub,
 	&subRelayTempUnitsCVarSub,
 	&subRelayTempUnitsFVarSub,
+#endif
+#ifdef ENABLE_SCHEDULE
+	&subRelayOnlySchedVarSub,
+
+	// sched.html
+	&subSchedNextVarSub,
+	&subSchedRowVarSub,
+#endif
+#ifdef ENABLE_SCENES
+
+	// scenes.html
+	&subSceneNextVarSub,
+	&subSceneNameVarSub,
+	&subSceneModesVarSub,
+	&subGroupNextVarSub,
+	&subGroupNameVarSub,
+	&subGroupMembersVarSub,
+#endif
+#ifdef ENABLE_THERMOMETER
+
+	// opts.html
 	&subRelayTempDelayVarSub,
 	&subRelayTempMarginVarSub,
 #endif
-	&subVerVarSub,
-	&subUptimeVarSub,
-	&subFreeRAMVarSub,
+
+	// net.html
+	&subMacAddrVarSub,
+	&subNMDHCPVarSub,
+	&subNMStaticVarSub,
+	&subIPAddressVarSub,
+	&subNetmaskVarSub,
+	&subGatewayVarSub,
+
+#ifdef ENABLE_THERMOMETER
+	&subThermoIntervalVarSub,
+	&subThermoRejectedVarSub,
+	&subThermoCRCErrorsVarSub,
+#endif
+#ifdef USE_ARDUINO_TIME_LIBRARY
+	&subDateVarSub,
+	&subTimeVarSub,
+	&subTimeSecsVarSub,
+#endif
+#ifdef ENABLE_STATS
+	&subLoopCountVarSub,
+	&subLoopLastVarSub,
+	&subLoopAvgVarSub,
+	&subLoopMaxVarSub,
+	&subWebLastVarSub,
+	&subWebAvgVarSub,
+	&subWebMaxVarSub,
+	&subRelayUpdatesVarSub,
+	&subRelayUpdatesSkippedVarSub,
+	&subEEBytesVarSub,
+	&subEERecordsVarSub,
+	&subEECoalescedVarSub,
+	&subSwitchesSuppressedVarSub,
+	&subTaskControlVarSub,
+	&subTaskSensorVarSub,
+	&subTaskPersistenceVarSub,
+	&subTaskHTTPVarSub,
+
+	// metrics
+	&subHashVarSub,
+	&subBucketNextVarSub,
+	&subBucketBoundVarSub,
+	&subBucketCountVarSub,
+	&subLoopSumVarSub,
+	&subLoopTotalVarSub,
+	&subPageNextVarSub,
+	&subPageNameVarSub,
+	&subPageRequestsVarSub,
+	&subPageTimeVarSub,
+	&subPageSizeVarSub,
+	&subRelaySwitchesVarSub,
+	&subFreeRAMNumVarSub,
+	&subFreeRAMLowVarSub,
+#ifdef ENABLE_THERMOMETER
+	&subConversionsVarSub,
+	&subConversionTimeVarSub,
+#endif
+#endif
 	NULL
 };
 
@@ -763,14 +2435,42 @@ void setup () {
 	DPRINTLN (F("SmartStrip " PROGRAM_VERSION));
 	DPRINTLN (F("Using Webbino " WEBBINO_VERSION));
 
+	// Before formatting the EEPROM, which saves options by relay id
+	for (i = 0; i < RELAYS_NO; i++)
+		relays[i].id = i + 1;
+
 	// Check and format EEPROM, in case
 	checkAndFormatEEPROM ();
 
-	for (i = 0; i < RELAYS_NO; i++) {
+	for (i = 0; i < RELAYS_NO; i++)
 		relays[i].readOptions ();
+
+#ifdef ENABLE_SCENES
+	// Before the journal, which might refer to them
+	Scenes::begin ();
+#endif
+
+	// Apply the most recent changes
+	journal.begin (relays);
+
+#ifdef ENABLE_SCHEDULE
+	for (i = 0; i < RELAYS_NO; i++)
+		schedules[i].begin (relays[i].id, now ());
+#endif
+
+	for (i = 0; i < RELAYS_NO; i++) {
+		// The state of these is not saved when it changes, see updateRelays()
+		if (relays[i].mode == RELMD_ON)
+			relays[i].state = RELAY_ON;
+		else if (relays[i].mode == RELMD_OFF || relays[i].mode == RELMD_SCHEDULE)
+			relays[i].state = RELAY_OFF;
+
+		relays[i].updateSwitchPoints ();
 		relays[i].effectState ();
-		relayHysteresis[i] = false;     // Start with no hysteresis
+		relays[i].hysteresisActive = false;     // Start with no hysteresis
 	}
+	RelayOutput::begin (relayBackend);
+	relayTimers.begin (relayTimerExpired);
 
 #if defined (WEBBINO_USE_ENC28J60) || defined (WEBBINO_USE_WIZ5100)
 	// Get MAC from EEPROM and init network interface
@@ -780,7 +2480,7 @@ void setup () {
 		EEPROM.get (EEPROM_MAC_ADDR + i, mac[i]);
 #endif
 
-	NetworkMode netmode;
+	byte netmode;
 	EEPROM.get (EEPROM_NETMODE_ADDR, netmode);
 	switch (netmode) {
 		case NETMODE_STATIC: {
@@ -841,8 +2541,16 @@ void setup () {
 	// Init webserver
 	webserver.begin (netint, pages, substitutions);
 
+#ifdef ENABLE_UDP
+	udpControl.begin (UDP_PORT, udpRequest);
+#endif
+
+#ifdef ENABLE_MQTT
+	mqtt.begin (IPAddress (MQTT_BROKER_B1, MQTT_BROKER_B2, MQTT_BROKER_B3, MQTT_BROKER_B4), MQTT_PORT, mqttCommand);
+#endif
+
 #ifdef ENABLE_THERMOMETER
-	thermometer.begin (THERMOMETER_PIN);
+	thermometer.begin (THERMOMETER_RESOLUTION, THERMO_MIN_INTERVAL);
 #endif
 
 	// Signal we're ready!
@@ -860,64 +2568,74 @@ void setup () {
 	}
 }
 
-void loop () {
-	webserver.loop ();
-
-#ifdef ENABLE_THERMOMETER
-	// Update temperature
-	if (thermometer.available && (millis () - lastTemperatureRequest > THERMO_READ_INTERVAL)) {
-		Temperature& temp = thermometer.getTemp ();
-		if (temp.valid) {
-			temperature = temp.celsius;
-
-			DPRINT (F("Temperature is now: "));
-			DPRINT (temperature);
-			DPRINTLN (F(" *C"));
+// Returns a bitmask of the relays that are on, relay 1 being the LSB
+RelayMask relayMask () {
+	RelayMask mask = 0;
 
-			lastTemperatureRequest = millis ();
-		}
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		if (relays[i].state == RELAY_ON)
+			mask |= static_cast<RelayMask> (1) << i;
 	}
-#endif
 
+	return mask;
+}
+
+/* Makes all relays match their mode, the current temperature, etc. This is
+ * only called when any of those has changed, see requestRelayUpdate().
+ */
+void updateRelays () {
 	for (byte i = 0; i < RELAYS_NO; i++) {
 		Relay& r = relays[i];
+		RelayState oldState = r.state;
 
 #ifdef ENABLE_THERMOMETER
-		bool& hysteresisEnabled = relayHysteresis[i];
+		// Temperature relays are left alone while their sensor is not available
+		const TempSnapshot& temp = thermometer.getSnapshot (r.sensor);
+		int temperature = temp.celsius;
+#endif
+
+		RelayMode mode = r.mode;
+
+#ifdef ENABLE_SCHEDULE
+		// Outside of its schedule a relay is just off
+		if (mode == RELMD_SCHEDULE || (r.scheduled && (mode == RELMD_GT || mode == RELMD_LT))) {
+			if (!schedules[i].isActive ())
+				mode = RELMD_OFF;
+			else if (mode == RELMD_SCHEDULE)
+				mode = RELMD_ON;
+		}
 #endif
 
-		switch (r.mode) {
+		switch (mode) {
 			case RELMD_ON:
-				if (r.state != RELAY_ON) {
+				if (r.state != RELAY_ON)
 					r.switchState (RELAY_ON);
-					r.writeOptions ();
-				}
 				break;
 			case RELMD_OFF:
-				if (r.state != RELAY_OFF) {
+				if (r.state != RELAY_OFF)
 					r.switchState (RELAY_OFF);
-					r.writeOptions ();
-				}
 				break;
 #ifdef ENABLE_THERMOMETER
 			case RELMD_GT:
-				if (((!hysteresisEnabled && temperature > r.threshold) || (hysteresisEnabled && temperature > r.threshold + r.hysteresis / 10.0)) && r.state != RELAY_ON) {
-					r.switchState (RELAY_ON);
-					r.writeOptions ();
-					hysteresisEnabled = true;
-				} else if (temperature <= r.threshold && r.state != RELAY_OFF) {
-					r.switchState (RELAY_OFF);
-					r.writeOptions ();
+				if (!temp.valid)
+					break;
+
+				if (temperature > (r.hysteresisActive ? r.hysteresisPoint : r.switchPoint) && r.state != RELAY_ON) {
+					if (switchUnlessHeld (i, RELAY_ON))
+						r.hysteresisActive = true;
+				} else if (temperature <= r.switchPoint && r.state != RELAY_OFF) {
+					switchUnlessHeld (i, RELAY_OFF);
 				}
 				break;
 			case RELMD_LT:
-				if (((!hysteresisEnabled && temperature < r.threshold) || (hysteresisEnabled && temperature < r.threshold - r.hysteresis / 10.0)) && r.state != RELAY_ON) {
-					r.switchState (RELAY_ON);
-					r.writeOptions ();
-					hysteresisEnabled = true;
-				} else if (temperature >= r.threshold && r.state != RELAY_OFF) {
-					r.switchState (RELAY_OFF);
-					r.writeOptions ();
+				if (!temp.valid)
+					break;
+
+				if (temperature < (r.hysteresisActive ? r.hysteresisPoint : r.switchPoint) && r.state != RELAY_ON) {
+					if (switchUnlessHeld (i, RELAY_ON))
+						r.hysteresisActive = true;
+				} else if (temperature >= r.switchPoint && r.state != RELAY_OFF) {
+					switchUnlessHeld (i, RELAY_OFF);
 				}
 				break;
 #endif
@@ -926,5 +2644,201 @@ void loop () {
 				DPRINTLN (r.mode);
 				break;
 		}
+
+		if (r.state != oldState) {
+#ifdef ENABLE_STATS
+			++relaySwitches[i];
+#endif
+
+			// Manual switches are never held, but they do start the delay
+			if (r.delay > 0)
+				relayTimers.schedule (i, r.delay * (60000U / TIMER_WHEEL_TICK));
+
+			/* Only temperature relays need their state saved, for the others
+			 * it follows from the mode (and the schedule, which is not known
+			 * at boot). This way applying a scene only takes a single record.
+			 */
+			if (r.mode == RELMD_GT || r.mode == RELMD_LT)
+				journal.markDirty (r.id);
+			relayChanged (r);
+		}
+	}
+
+	// Switch all the relays that changed at once
+	RelayOutput::commit ();
+}
+
+#ifdef ENABLE_THERMOMETER
+/* Makes the thermometer sample quickly while any temperature relay is close to
+ * switching, and back off exponentially while they are all far from it.
+ */
+void updateSampleInterval () {
+	boolean any = false, near = false;
+
+	for (byte i = 0; i < RELAYS_NO && !near; i++) {
+		Relay& r = relays[i];
+
+		if (r.mode == RELMD_GT || r.mode == RELMD_LT) {
+			const TempSnapshot& temp = thermometer.getSnapshot (r.sensor);
+			if (temp.valid) {
+				any = true;
+				near = abs (temp.celsius - r.switchPoint) <= THERMO_NEAR_BAND ||
+				       abs (temp.celsius - r.hysteresisPoint) <= THERMO_NEAR_BAND;
+			}
+		}
+	}
+
+	unsigned long interval;
+	if (near)
+		interval = THERMO_MIN_INTERVAL;
+	else if (!any)
+		interval = THERMO_MAX_INTERVAL;
+	else
+		interval = min (thermometer.getInterval () * 2, THERMO_MAX_INTERVAL);
+
+	thermometer.setInterval (interval);
+}
+#endif
+
+// Keeps the relays in line with their configuration
+void controlTask () {
+#ifdef ENABLE_SCHEDULE
+	// Schedules know when they will change next, so this is cheap
+	time_t t = now ();
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		if (schedules[i].check (t))
+			requestRelayUpdate ();
+	}
+#endif
+
+	relayTimers.loop ();
+
+	// Relays only need to be looked at when something has changed
+	if (relaysNeedUpdate) {
+		relaysNeedUpdate = false;
+		updateRelays ();
+#ifdef ENABLE_STATS
+		++relayUpdates;
+	} else {
+		++relayUpdatesSkipped;
+#endif
+	}
+
+#ifdef ENABLE_HISTORY
+	history.loop (static_cast<byte> (relayMask ()));
+#endif
+}
+
+void sensorTask () {
+#ifdef ENABLE_THERMOMETER
+	// Update temperature, this never blocks
+	if (thermometer.loop ()) {
+		DPRINT (F("Temperature is now: "));
+		DPRINT (thermometer.getSnapshot ().celsius / 100.0);
+		DPRINTLN (F(" *C"));
+
+		updateSampleInterval ();
+		requestRelayUpdate ();
+
+		// Let /events clients know, only when what they would get differs
+		const TempSnapshot& snap = thermometer.getSnapshot ();
+		if (snap.valid != lastTemp.valid || (snap.valid && snap.celsius != lastTemp.celsius)) {
+			lastTemp = snap;
+			stateChanged ();
+			tempVersion = stateVersion;
+		}
+
+#ifdef ENABLE_HISTORY
+		const TempSnapshot& temp = thermometer.getSnapshot ();
+		if (temp.valid)
+			history.addSample (temp.celsius);
+#endif
+	}
+#endif
+}
+
+void persistenceTask () {
+	journal.loop ();
+}
+
+#ifdef ENABLE_MQTT
+/* Publishes the relays and the temperature when they have changed, retained, to
+ * MQTT_PREFIX/relays, as e.g. {"modes":"IOGS","states":"1001"} (modes as in
+ * scenes.html, states as 1 for on), and to MQTT_PREFIX/temp.
+ */
+void mqttTask () {
+	unsigned long since;
+
+	mqtt.loop ();
+
+	if (mqtt.due (stateVersion, since)) {
+		boolean relaysChanged = since == 0;
+		for (byte i = 0; i < RELAYS_NO && !relaysChanged; i++)
+			relaysChanged = relayVersion[i] > since;
+
+		if (relaysChanged) {
+			// {"modes":"...","states":"..."}, with a char per relay in both
+			char buf[10 + RELAYS_NO + 12 + RELAYS_NO + 2 + 1];
+			PString payload (buf, sizeof (buf));
+
+			payload.print (F("{\"modes\":\""));
+			for (byte i = 0; i < RELAYS_NO; i++)
+				payload.print (static_cast<char> (pgm_read_byte (&MODE_CHARS[relays[i].mode])));
+			payload.print (F("\",\"states\":\""));
+			for (byte i = 0; i < RELAYS_NO; i++)
+				payload.print (relays[i].state == RELAY_ON ? '1' : '0');
+			payload.print (F("\"}"));
+
+			// Never publish a truncated message
+			if (payload.length () == sizeof (buf) - 1)
+				mqtt.publish (PSTR ("relays"), buf);
+		}
+
+		if (since == 0 || tempVersion > since) {
+			pBuffer.begin ();
+			evaluate_temp_json (NULL);
+			mqtt.publish (PSTR ("temp"), replaceBuffer);
+		}
+	}
+}
+#endif
+
+#ifdef ENABLE_UDP
+void udpTask () {
+	udpControl.loop ();
+}
+#endif
+
+// Serves at most one request
+void httpTask () {
+#ifdef ENABLE_STATS
+	unsigned long start = micros ();
+
+	servedPage = HTML_PAGES_NO;
+#endif
+
+	webserver.loop ();
+
+#ifdef ENABLE_STATS
+	unsigned long elapsed = micros () - start;
+	webStats.add (elapsed);
+	if (servedPage < HTML_PAGES_NO) {
+		++pageStats[servedPage].requests;
+		pageStats[servedPage].time.add (elapsed);
 	}
+#endif
+}
+
+void loop () {
+#ifdef ENABLE_STATS
+	unsigned long loopStart = micros ();
+#endif
+
+	scheduler.loop ();
+
+#ifdef ENABLE_STATS
+	unsigned long elapsed = micros () - loopStart;
+	loopStats.add (elapsed);
+	loopHistogram.add (elapsed);
+#endif
 }
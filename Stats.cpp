@@ -0,0 +1,123 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "Stats.h"
+
+// Weight of a new sample in the moving average is 1/2^AVG_SHIFT
+#define AVG_SHIFT 4
+
+TimingStats::TimingStats () {
+	reset ();
+}
+
+void TimingStats::reset () {
+	count = 0;
+	last = 0;
+	max = 0;
+	avg = 0;
+}
+
+void TimingStats::add (unsigned long us) {
+	last = us;
+	if (us > max)
+		max = us;
+
+	if (count == 0)
+		avg = us;
+	else if (us > avg)
+		avg += (us - avg) >> AVG_SHIFT;
+	else
+		avg -= (avg - us) >> AVG_SHIFT;
+
+	++count;
+}
+
+void TotalTime::reset () {
+	seconds = 0;
+	us = 0;
+}
+
+void TotalTime::add (unsigned long _us) {
+	us += _us % 1000000UL;
+	seconds += _us / 1000000UL;
+	if (us >= 1000000UL) {
+		us -= 1000000UL;
+		++seconds;
+	}
+}
+
+LogHistogram::LogHistogram () {
+	reset ();
+}
+
+void LogHistogram::reset () {
+	count = 0;
+	total.reset ();
+	for (byte i = 0; i < STATS_HIST_BUCKETS; i++)
+		buckets[i] = 0;
+}
+
+void LogHistogram::add (unsigned long us) {
+	byte i = 0;
+
+	while (i < STATS_HIST_BUCKETS && us > bound (i))
+		++i;
+
+	if (i < STATS_HIST_BUCKETS)
+		++buckets[i];
+
+	++count;
+	total.add (us);
+}
+
+#ifdef __AVR__
+#define STACK_CANARY 0xC5
+
+extern uint8_t _end, __stack;
+extern int __heap_start, *__brkval;
+
+/* Fills all the RAM between the static data and the top of the stack with the
+ * canary, before anything else runs. This is called by the startup code, at
+ * which point the stack is still empty, so this must not use it.
+ */
+void paintStack () __attribute__ ((naked, used, section (".init3")));
+
+void paintStack () {
+	uint8_t *p = &_end;
+
+	while (p <= &__stack)
+		*p++ = STACK_CANARY;
+}
+
+int freeRamLowWatermark () {
+	const uint8_t *p = reinterpret_cast<const uint8_t *> (__brkval == 0 ? &__heap_start : __brkval);
+	int n = 0;
+
+	while (p <= &__stack && *p == STACK_CANARY) {
+		++p;
+		++n;
+	}
+
+	return n;
+}
+#else
+int freeRamLowWatermark () {
+	return -1;
+}
+#endif
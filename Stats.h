@@ -0,0 +1,85 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _STATS_H_
+#define _STATS_H_
+
+#include <Arduino.h>
+#include "common.h"
+
+/* Keeps track of how long something takes, in microseconds. The average is an
+ * exponential moving average, so that we don't need to keep a running total
+ * that would overflow after a while.
+ */
+class TimingStats {
+public:
+	unsigned long count;
+	unsigned long last;
+	unsigned long max;
+	unsigned long avg;
+
+	TimingStats ();
+
+	void reset ();
+	void add (unsigned long us);
+};
+
+/* Sum of many durations, split into seconds and microseconds so that it takes
+ * years to overflow.
+ */
+struct TotalTime {
+	unsigned long seconds;
+	unsigned long us;
+
+	void reset ();
+	void add (unsigned long _us);
+};
+
+// Bucket 0 of LogHistogram holds samples up to 2^LOG_HIST_MIN_SHIFT us
+#define LOG_HIST_MIN_SHIFT 6
+
+/* Histogram of durations, in STATS_HIST_BUCKETS buckets of exponentially
+ * increasing width: every bucket holds samples up to twice the upper bound of
+ * the previous one. Samples longer than the last bound are only counted in the
+ * total.
+ */
+class LogHistogram {
+public:
+	unsigned long count;
+	TotalTime total;
+	unsigned long buckets[STATS_HIST_BUCKETS];
+
+	LogHistogram ();
+
+	void reset ();
+	void add (unsigned long us);
+
+	// Upper bound of a bucket (us)
+	static unsigned long bound (byte bucket) {
+		return 1UL << (bucket + LOG_HIST_MIN_SHIFT);
+	}
+};
+
+/* Lowest amount of free RAM there has been between the heap and the stack
+ * since boot, as told by how much of the pattern painted there at startup is
+ * still intact. Returns -1 where this is not supported.
+ */
+int freeRamLowWatermark ();
+
+#endif
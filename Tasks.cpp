@@ -0,0 +1,59 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "Tasks.h"
+
+Task::Task (TaskFunction _run, unsigned int _period, byte _priority, unsigned long _budget):
+	run (_run), period (_period), priority (_priority), budget (_budget), lastRun (0), overruns (0), maxTime (0) {
+}
+
+TaskScheduler::TaskScheduler (Task *_tasks, byte _nTasks): tasks (_tasks), nTasks (_nTasks) {
+}
+
+void TaskScheduler::loop () {
+	unsigned long now = millis ();
+	Task *next = NULL;
+
+	for (byte i = 0; i < nTasks; i++) {
+		Task& t = tasks[i];
+
+		if (now - t.lastRun >= t.period && (next == NULL || t.priority < next -> priority))
+			next = &t;
+	}
+
+	if (next != NULL) {
+		unsigned long start = micros ();
+
+		next -> lastRun = now;
+		next -> run ();
+
+		unsigned long elapsed = micros () - start;
+		if (elapsed > next -> budget)
+			++next -> overruns;
+		if (elapsed > next -> maxTime)
+			next -> maxTime = elapsed;
+	}
+}
+
+void TaskScheduler::resetStats () {
+	for (byte i = 0; i < nTasks; i++) {
+		tasks[i].overruns = 0;
+		tasks[i].maxTime = 0;
+	}
+}
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _TASKS_H_
+#define _TASKS_H_
+
+#include <Arduino.h>
+
+typedef void (*TaskFunction) ();
+
+struct Task {
+	TaskFunction run;
+	unsigned int period;			// Minimum time between runs (ms), 0 to run whenever possible
+	byte priority;					// 0 is the most urgent
+	unsigned long budget;			// Time a run is expected to take at most (us)
+
+	// Filled in by the scheduler
+	unsigned long lastRun;			// millis() at the start of the last run
+	unsigned long overruns;			// Runs that went over budget
+	unsigned long maxTime;			// Longest run so far (us)
+
+	Task (TaskFunction _run, unsigned int _period, byte _priority, unsigned long _budget);
+};
+
+/* Minimal cooperative scheduler.
+ *
+ * Every call to loop() runs the most urgent task that is due, if any, so that
+ * as soon as any task returns, the more urgent ones get the chance to run. A
+ * task that has become due waits at most for the run of a single other task,
+ * so the latency of urgent tasks is bound by the budget of the others, as long
+ * as those are respected. Tasks can't be preempted though, so a task going over
+ * its budget is only recorded as an overrun.
+ */
+class TaskScheduler {
+public:
+	TaskScheduler (Task *_tasks, byte _nTasks);
+
+	void loop ();
+
+	void resetStats ();
+
+private:
+	Task *tasks;
+	byte nTasks;
+};
+
+#endif
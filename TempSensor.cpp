@@ -0,0 +1,229 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "TempSensor.h"
+#include "debug.h"
+
+// DS18B20 commands
+#define CMD_CONVERT_T 0x44
+#define CMD_READ_SCRATCHPAD 0xBE
+#define CMD_WRITE_SCRATCHPAD 0x4E
+
+#define DS18B20_FAMILY 0x28
+
+#define SCRATCHPAD_SIZE 9
+
+// Maximum conversion time at 12 bits, plus some margin
+#define CONVERSION_TIMEOUT 800
+
+// Value of the temperature register at power-on (85 *C)
+#define POWER_ON_RAW 0x0550
+
+static const TempSnapshot INVALID_SNAPSHOT = {false, 0, 0};
+
+int TempSnapshot::toFahrenheit () const {
+	return static_cast<long> (celsius) * 9 / 5 + 3200;
+}
+
+static int median3 (int a, int b, int c) {
+	int lo = min (a, b), hi = max (a, b);
+
+	return max (lo, min (hi, c));
+}
+
+TempSensor::TempSensor (byte pin): available (false), crcErrors (0), rejectedReadings (0),
+	conversions (0), conversionTime (0),
+	bus (pin), state (ST_IDLE), resolution (12), interval (0), lastRequest (0),
+	nSensors (0), nextRead (0) {
+
+	for (byte i = 0; i < MAX_SENSORS; i++) {
+		snapshots[i] = INVALID_SNAPSHOT;
+		historyPos[i] = 0;
+		historyLen[i] = 0;
+	}
+}
+
+const TempSnapshot& TempSensor::getSnapshot (byte sensor) const {
+	return sensor < nSensors ? snapshots[sensor] : INVALID_SNAPSHOT;
+}
+
+const byte *TempSensor::getAddress (byte sensor) const {
+	return sensor < nSensors ? addresses[sensor] : NULL;
+}
+
+void TempSensor::enumerate () {
+	nSensors = 0;
+	bus.reset_search ();
+	while (nSensors < MAX_SENSORS && bus.search (addresses[nSensors])) {
+		const byte *addr = addresses[nSensors];
+		if (OneWire::crc8 (addr, ROM_SIZE - 1) == addr[ROM_SIZE - 1] && addr[0] == DS18B20_FAMILY)
+			++nSensors;
+	}
+}
+
+void TempSensor::begin (byte _resolution, unsigned long _interval) {
+	resolution = _resolution;
+	interval = _interval;
+
+	enumerate ();
+	available = nSensors > 0 && bus.reset ();
+	if (available) {
+		// Set the resolution of all sensors at once. TH and TL are not used.
+		bus.skip ();
+		bus.write (CMD_WRITE_SCRATCHPAD);
+		bus.write (0);
+		bus.write (0);
+		bus.write (((resolution - 9) << 5) | 0x1F);
+
+		DPRINT (F("Temperature sensors found: "));
+		DPRINTLN (nSensors);
+
+		// Get a first reading as soon as possible
+		requestConversion ();
+	} else {
+		DPRINTLN (F("No temperature sensor found"));
+	}
+}
+
+boolean TempSensor::requestConversion () {
+	boolean ret = false;
+
+	// Skip ROM, so that all sensors convert at the same time
+	if (bus.reset ()) {
+		bus.skip ();
+		bus.write (CMD_CONVERT_T);
+		state = ST_CONVERTING;
+		ret = true;
+	} else {
+		// Nobody answered, so the last readings can't be trusted anymore
+		DPRINTLN (F("No presence pulse from temperature sensors"));
+		invalidateAll ();
+	}
+
+	lastRequest = millis ();
+
+	return ret;
+}
+
+void TempSensor::invalidateAll () {
+	for (byte i = 0; i < nSensors; i++)
+		snapshots[i].valid = false;
+}
+
+void TempSensor::publish (byte sensor, int celsius) {
+	int *h = history[sensor];
+
+	// Until we have three readings, pretend the first one was repeated
+	if (historyLen[sensor] == 0) {
+		h[0] = h[1] = h[2] = celsius;
+		historyLen[sensor] = 3;
+	} else {
+		h[historyPos[sensor]] = celsius;
+	}
+	historyPos[sensor] = (historyPos[sensor] + 1) % 3;
+
+	TempSnapshot& snapshot = snapshots[sensor];
+	snapshot.celsius = median3 (h[0], h[1], h[2]);
+	snapshot.timestamp = millis ();
+	snapshot.valid = true;
+}
+
+boolean TempSensor::readScratchpad (byte sensor) {
+	byte data[SCRATCHPAD_SIZE];
+
+	/* The scratchpad keeps the result of the conversion, so it can be read
+	 * again if the first attempt got corrupted.
+	 */
+	for (byte attempt = 0; attempt <= THERMO_READ_RETRIES; attempt++) {
+		if (!bus.reset ())
+			break;
+
+		bus.select (addresses[sensor]);
+		bus.write (CMD_READ_SCRATCHPAD);
+		for (byte i = 0; i < SCRATCHPAD_SIZE; i++)
+			data[i] = bus.read ();
+
+		if (OneWire::crc8 (data, SCRATCHPAD_SIZE - 1) == data[SCRATCHPAD_SIZE - 1]) {
+			int16_t raw = (data[1] << 8) | data[0];
+
+			/* A sensor that has just been (re)powered reports 85 *C before
+			 * its first conversion: only trust that if we were close already.
+			 */
+			if (raw == POWER_ON_RAW && !(snapshots[sensor].valid && snapshots[sensor].celsius > 8000)) {
+				DPRINT (F("Ignoring power-on value from temperature sensor "));
+				DPRINTLN (sensor);
+				break;
+			}
+
+			// Raw value is in 1/16 of degree, undefined bits must be ignored
+			raw &= ~((1 << (12 - resolution)) - 1);
+			publish (sensor, static_cast<long> (raw) * 100 / 16);
+
+			return true;
+		}
+
+		DPRINT (F("CRC error on temperature sensor "));
+		DPRINTLN (sensor);
+		++crcErrors;
+	}
+
+	/* Don't let relays keep acting on the previous value: they will hold their
+	 * state until a reading gets through again
+	 */
+	++rejectedReadings;
+	snapshots[sensor].valid = false;
+
+	return false;
+}
+
+boolean TempSensor::loop () {
+	boolean ret = false;
+
+	if (available) {
+		switch (state) {
+			case ST_IDLE:
+				if (millis () - lastRequest >= interval)
+					requestConversion ();
+				break;
+			case ST_CONVERTING:
+				// Sensors keep the bus low until all conversions are complete
+				if (bus.read_bit ()) {
+					nextRead = 0;
+					state = ST_READING;
+				} else if (millis () - lastRequest > CONVERSION_TIMEOUT) {
+					DPRINTLN (F("Temperature conversion timed out"));
+					invalidateAll ();
+					state = ST_IDLE;
+				}
+				break;
+			case ST_READING:
+				// One sensor at a time, to keep every call short
+				readScratchpad (nextRead);
+				if (++nextRead >= nSensors) {
+					state = ST_IDLE;
+					++conversions;
+					conversionTime = millis () - lastRequest;
+					ret = true;
+				}
+				break;
+		}
+	}
+
+	return ret;
+}
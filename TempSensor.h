@@ -0,0 +1,127 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _TEMPSENSOR_H_
+#define _TEMPSENSOR_H_
+
+#include <Arduino.h>
+#include <OneWire.h>
+#include "common.h"
+
+// Size of a 1-Wire ROM ID (bytes)
+#define ROM_SIZE 8
+
+/* A temperature reading, as published by TempSensor. Temperatures are kept in
+ * hundredths of degree, so that we never need floating point math.
+ */
+struct TempSnapshot {
+	boolean valid;
+	int celsius;					// Hundredths of degree Celsius
+	unsigned long timestamp;		// millis() when this was read
+
+	int toFahrenheit () const;		// Hundredths of degree Fahrenheit
+};
+
+/* Non-blocking driver for a bus of up to MAX_SENSORS DS18B20 sensors.
+ *
+ * Sensors are enumerated at startup, and are then identified by their index,
+ * i.e. the order in which the bus search found them.
+ *
+ * Instead of waiting for the conversion to complete (which takes up to 750 ms
+ * at 12 bits of resolution), loop() goes through a small state machine: it
+ * requests a conversion to all sensors at once, then polls the bus until they
+ * all signal they're ready, then reads the scratchpad of one sensor per call
+ * and publishes a new snapshot for it. Every call only takes a few 1-Wire time
+ * slots, so the webserver is never stalled.
+ *
+ * Every published value is the median of the last three valid readings of the
+ * sensor, so that a single bad reading cannot make a relay switch. Readings
+ * that fail the CRC check are retried a few times before being rejected.
+ * A rejected reading, like a conversion that times out or a bus where nobody
+ * answers, marks the snapshot as invalid until a good reading comes in.
+ *
+ * Readers should only ever look at the snapshots, never at the bus.
+ */
+class TempSensor {
+public:
+	TempSensor (byte pin);
+
+	boolean available;
+
+	// Statistics
+	unsigned long crcErrors;
+	unsigned long rejectedReadings;
+	unsigned long conversions;
+	unsigned long conversionTime;	// From the request to all sensors read, last time (ms)
+
+	void begin (byte resolution, unsigned long interval);
+
+	// Returns true when new snapshots have just been published for all sensors
+	boolean loop ();
+
+	unsigned long getInterval () const {
+		return interval;
+	}
+
+	// Takes effect immediately if the new interval is shorter
+	void setInterval (unsigned long _interval) {
+		interval = _interval;
+	}
+
+	byte getSensorCount () const {
+		return nSensors;
+	}
+
+	// Invalid snapshot for sensors that are not there
+	const TempSnapshot& getSnapshot (byte sensor = 0) const;
+
+	// NULL for sensors that are not there
+	const byte *getAddress (byte sensor) const;
+
+private:
+	enum State {
+		ST_IDLE,
+		ST_CONVERTING,
+		ST_READING
+	};
+
+	OneWire bus;
+	State state;
+	byte resolution;
+	unsigned long interval;
+	unsigned long lastRequest;
+	byte nSensors;
+	byte nextRead;
+	byte addresses[MAX_SENSORS][ROM_SIZE];
+	TempSnapshot snapshots[MAX_SENSORS];
+
+	// Last three valid readings of every sensor, for the median filter
+	int history[MAX_SENSORS][3];
+	byte historyPos[MAX_SENSORS];
+	byte historyLen[MAX_SENSORS];
+
+	void publish (byte sensor, int celsius);
+	void invalidateAll ();
+
+	void enumerate ();
+	boolean requestConversion ();
+	boolean readScratchpad (byte sensor);
+};
+
+#endif
@@ -0,0 +1,95 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "TimerWheel.h"
+
+static_assert ((TIMER_WHEEL_SLOTS & (TIMER_WHEEL_SLOTS - 1)) == 0, "TIMER_WHEEL_SLOTS must be a power of 2");
+static_assert (TIMER_WHEEL_SLOTS < 0xFF && TIMER_WHEEL_TIMERS <= sizeof (RelayMask) * 8, "Timer wheel too large");
+
+TimerWheel::TimerWheel (): callback (NULL), lastTick (0), cursor (0) {
+	for (byte i = 0; i < TIMER_WHEEL_SLOTS; i++)
+		heads[i] = NONE;
+
+	for (byte i = 0; i < TIMER_WHEEL_TIMERS; i++)
+		slotOf[i] = NONE;
+}
+
+void TimerWheel::begin (TimerCallback _callback) {
+	callback = _callback;
+	lastTick = millis ();
+}
+
+void TimerWheel::schedule (byte timer, unsigned int ticks) {
+	if (ticks == 0)
+		ticks = 1;
+
+	cancel (timer);
+
+	byte slot = (cursor + ticks) & (TIMER_WHEEL_SLOTS - 1);
+	rounds[timer] = (ticks - 1) / TIMER_WHEEL_SLOTS;
+	slotOf[timer] = slot;
+	next[timer] = heads[slot];
+	heads[slot] = timer;
+}
+
+void TimerWheel::cancel (byte timer) {
+	byte slot = slotOf[timer];
+
+	if (slot != NONE) {
+		// Lists are short, no need for them to be doubly-linked
+		byte *p = &heads[slot];
+		while (*p != timer)
+			p = &next[*p];
+		*p = next[timer];
+
+		slotOf[timer] = NONE;
+	}
+}
+
+void TimerWheel::loop () {
+	while (millis () - lastTick >= TIMER_WHEEL_TICK) {
+		RelayMask expired = 0;
+
+		lastTick += TIMER_WHEEL_TICK;
+		cursor = (cursor + 1) & (TIMER_WHEEL_SLOTS - 1);
+
+		byte *p = &heads[cursor];
+		while (*p != NONE) {
+			byte timer = *p;
+
+			if (rounds[timer] > 0) {
+				--rounds[timer];
+				p = &next[timer];
+			} else {
+				*p = next[timer];
+				slotOf[timer] = NONE;
+				expired |= static_cast<RelayMask> (1) << timer;
+			}
+		}
+
+		// Only call back now, so that the callback can freely (re)schedule timers
+		for (byte i = 0; expired != 0 && i < TIMER_WHEEL_TIMERS; i++) {
+			if ((expired >> i) & 0x01) {
+				expired &= ~(static_cast<RelayMask> (1) << i);
+				if (callback)
+					callback (i);
+			}
+		}
+	}
+}
@@ -0,0 +1,77 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _TIMERWHEEL_H_
+#define _TIMERWHEEL_H_
+
+#include <Arduino.h>
+#include "enums.h"
+
+// Number of slots of the wheel, must be a power of 2
+#define TIMER_WHEEL_SLOTS 16
+
+// Length of a tick (ms)
+#define TIMER_WHEEL_TICK 1000UL
+
+// Timer ids go from 0 to TIMER_WHEEL_TIMERS - 1, one per relay
+#define TIMER_WHEEL_TIMERS RELAYS_NO
+
+typedef void (*TimerCallback) (byte timer);
+
+/* Hashed timer wheel.
+ *
+ * A timer due in N ticks is put in the list of the slot the wheel will point
+ * to after N ticks, together with the number of full turns to wait. At every
+ * tick only the list of the current slot is looked at, so the cost does not
+ * depend on how many timers are pending.
+ *
+ * Timers are single-shot: when one expires, the callback is called with its
+ * id.
+ */
+class TimerWheel {
+public:
+	TimerWheel ();
+
+	void begin (TimerCallback _callback);
+
+	// (Re)starts a timer, ticks should be at least 1
+	void schedule (byte timer, unsigned int ticks);
+
+	void cancel (byte timer);
+
+	boolean isPending (byte timer) const {
+		return slotOf[timer] != NONE;
+	}
+
+	// Advances the wheel, call this often
+	void loop ();
+
+private:
+	static const byte NONE = 0xFF;
+
+	TimerCallback callback;
+	unsigned long lastTick;
+	byte cursor;
+	byte heads[TIMER_WHEEL_SLOTS];			// First timer in every slot
+	byte next[TIMER_WHEEL_TIMERS];			// Next timer in the same slot
+	byte slotOf[TIMER_WHEEL_TIMERS];		// Slot a timer is in, NONE if not pending
+	unsigned int rounds[TIMER_WHEEL_TIMERS];	// Turns left before expiring
+};
+
+#endif
@@ -0,0 +1,132 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "common.h"
+
+#ifdef ENABLE_UDP
+
+#include "UdpControl.h"
+#include "SipHash.h"
+#ifdef UDP_KEY
+#include <EEPROM.h>
+#include "Crc8.h"
+#endif
+
+static_assert (sizeof (UdpPacket) == 40, "UdpPacket must not have padding");
+static_assert (RELAYS_NO <= 32, "UdpPacket only has room for 32 relays");
+
+#ifdef UDP_KEY
+static const byte udpKey[SIPHASH_KEY_SIZE] PROGMEM = {UDP_KEY};
+#endif
+
+UdpControl::UdpControl (UDP& _udp): udp (_udp), handler (NULL), lastSeq (0) {
+#ifdef UDP_KEY
+	savedSeq = 0;
+#endif
+}
+
+void UdpControl::begin (word port, UdpHandler _handler) {
+	handler = _handler;
+
+#ifdef UDP_KEY
+	/* Anything up to the mark might have been accepted before a reboot. If it
+	 * is not valid, this is the first boot with UDP_KEY, so nothing was.
+	 */
+	uint32_t mark;
+	EEPROM.get (EEPROM_UDP_SEQ_ADDR, mark);
+	if (EEPROM.read (EEPROM_UDP_SEQ_ADDR + sizeof (mark)) == crc8 (reinterpret_cast<const byte *> (&mark), sizeof (mark)))
+		lastSeq = savedSeq = mark;
+#endif
+
+	udp.begin (port);
+}
+
+#ifdef UDP_KEY
+void UdpControl::format () {
+	saveSeq (0);
+	lastSeq = 0;
+}
+
+void UdpControl::saveSeq (uint32_t mark) {
+	EEPROM.put (EEPROM_UDP_SEQ_ADDR, mark);
+	EEPROM.update (EEPROM_UDP_SEQ_ADDR + sizeof (mark), crc8 (reinterpret_cast<const byte *> (&mark), sizeof (mark)));
+	savedSeq = mark;
+}
+
+// Computes the MAC of everything but the MAC itself
+void UdpControl::sign (byte *mac) {
+	byte key[SIPHASH_KEY_SIZE];
+
+	memcpy_P (key, udpKey, SIPHASH_KEY_SIZE);
+	sipHash24 (key, reinterpret_cast<const byte *> (&packet), offsetof (UdpPacket, mac), mac);
+}
+#endif
+
+void UdpControl::loop () {
+	int size = udp.parsePacket ();
+	if (size == 0)
+		return;
+
+	// Anything that is not even the right size is not for us, just drop it
+	if (size != sizeof (UdpPacket) ||
+	    udp.read (reinterpret_cast<byte *> (&packet), sizeof (packet)) != sizeof (packet) ||
+	    packet.magic != UDP_MAGIC)
+		return;
+
+#ifdef UDP_KEY
+	byte mac[SIPHASH_SIZE];
+	sign (mac);
+	if (memcmp (mac, packet.mac, SIPHASH_SIZE) != 0)
+		return;
+#endif
+
+	byte status;
+	if (packet.version != UDP_PROTO_VERSION ||
+	    (packet.command != UDP_CMD_GET && packet.command != UDP_CMD_SET)) {
+		status = UDP_BAD_REQUEST;
+#ifdef UDP_KEY
+	} else if (packet.command == UDP_CMD_SET && packet.seq <= lastSeq) {
+		status = UDP_OLD_SEQ;
+		packet.seq = lastSeq;
+#endif
+	} else {
+		if (packet.command == UDP_CMD_SET) {
+			lastSeq = packet.seq;
+#ifdef UDP_KEY
+			if (lastSeq >= savedSeq)
+				saveSeq (lastSeq <= 0xFFFFFFFFUL - UDP_SEQ_RESERVE ? lastSeq + UDP_SEQ_RESERVE : 0xFFFFFFFFUL);
+#endif
+		}
+		status = handler (packet);
+	}
+
+	packet.command |= UDP_REPLY;
+	packet.status = status;
+#ifdef UDP_KEY
+	sign (packet.mac);
+#else
+	memset (packet.mac, 0, sizeof (packet.mac));
+#endif
+
+	udp.beginPacket (udp.remoteIP (), udp.remotePort ());
+	udp.write (reinterpret_cast<const byte *> (&packet), sizeof (packet));
+	udp.endPacket ();
+}
+
+#endif
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _UDPCONTROL_H_
+#define _UDPCONTROL_H_
+
+#include <Arduino.h>
+#include <Udp.h>
+#include "common.h"
+
+#define UDP_MAGIC 'S'
+#define UDP_PROTO_VERSION 1
+
+// Commands, replies have UDP_REPLY set
+#define UDP_CMD_GET 1
+#define UDP_CMD_SET 2
+#define UDP_REPLY 0x80
+
+// Status of replies
+#define UDP_OK 0
+#define UDP_BAD_REQUEST 1			// Unknown version or command
+#define UDP_OLD_SEQ 2				// Sequence number not newer than the last one
+#define UDP_BAD_MODE 3				// Nothing was changed
+
+/* Request and reply of the UDP control protocol, which share the same fixed
+ * layout. Multi-byte fields are little-endian (i.e. native on all the boards
+ * this runs on), relays are numbered from 0 in masks and modes. See also
+ * tools/udpctl.py.
+ */
+struct UdpPacket {
+	byte magic;					// UDP_MAGIC
+	byte version;				// UDP_PROTO_VERSION
+	byte command;
+	byte status;				// Replies only
+	uint32_t seq;				// Echoed in the reply, see UdpControl
+	uint32_t mask;				// SET: relays to change, reply: relays that are on
+	uint32_t stateVersion;		// Replies only
+	byte modes[16];				// A nibble per relay, the low one first
+	byte mac[8];				// SipHash-2-4 of the above, if UDP_KEY is defined
+};
+
+// Handles a request that has been validated, returns the status of the reply
+typedef byte (*UdpHandler) (UdpPacket& packet);
+
+/* Serves the UDP control protocol, an alternative to HTTP with much less
+ * overhead, meant for automation: every request is a single datagram and gets
+ * a single datagram back, built in place in the same buffer.
+ *
+ * When UDP_KEY is defined, requests without the right MAC are dropped and
+ * replies get one too. SET requests must then also have a sequence number
+ * higher than the last one accepted, so that they can't be replayed. A request
+ * failing this gets an UDP_OLD_SEQ reply, carrying the last sequence number
+ * accepted rather than its own, so that clients can pick up from there.
+ *
+ * To keep this working across reboots, a mark UDP_SEQ_RESERVE ahead of the
+ * sequence number being accepted is saved to EEPROM whenever the previous one
+ * is reached, before the request is acted upon. After a reboot, the mark is
+ * taken as the last sequence number accepted.
+ */
+class UdpControl {
+public:
+	UdpControl (UDP& _udp);
+
+	void begin (word port, UdpHandler _handler);
+
+#ifdef UDP_KEY
+	// Resets the saved sequence number, to be used when formatting the EEPROM
+	void format ();
+#endif
+
+	// Serves at most one request
+	void loop ();
+
+private:
+	UDP& udp;
+	UdpHandler handler;
+	UdpPacket packet;
+	uint32_t lastSeq;
+
+#ifdef UDP_KEY
+	uint32_t savedSeq;			// Mark last saved to EEPROM
+
+	void sign (byte *mac);
+	void saveSeq (uint32_t mark);
+#endif
+};
+
+#endif
@@ -23,17 +23,41 @@
 // Define this to disable debug messages
 #define NDEBUG
 
+/* Number of relays, up to 32. Note that every relay takes about 25 bytes of
+ * RAM, so more than 16 will need something bigger than an Uno.
+ *
+ * After changing this, run tools/html2h.py again, since the pages have one
+ * line per relay.
+ */
 #define RELAYS_NO 4
-#define RELAY1_PIN 8
-#define RELAY2_PIN 7
-#define RELAY3_PIN 6
-#define RELAY4_PIN 5
-
-/* Define this if your relays are activated setting their input pin LOW.
- * Note that this applies to all relays, you can't currently have mixed active-
- * high and active-low relays.
+
+/* How the relays are connected, define one of:
+ * - RELAY_BACKEND_GPIO: every relay has its own pin, listed in RELAY_PINS;
+ * - RELAY_BACKEND_74HC595: a chain of 74HC595 shift registers, 8 relays each,
+ *   relay 1 being output Q0 of the register whose serial input is connected to
+ *   the Arduino;
+ * - RELAY_BACKEND_MCP23017: MCP23017 I2C expanders with consecutive addresses
+ *   starting from MCP23017_ADDRESS, 16 relays each, relay 1 being GPA0 of the
+ *   first one.
+ */
+#define RELAY_BACKEND_GPIO
+//#define RELAY_BACKEND_74HC595
+//#define RELAY_BACKEND_MCP23017
+
+#define RELAY_PINS 8, 7, 6, 5
+
+#define SR_DATA_PIN 3
+#define SR_CLOCK_PIN 4
+#define SR_LATCH_PIN 9
+
+#define MCP23017_ADDRESS 0x20
+
+/* Define this if your relays are activated setting their input pin LOW. This
+ * applies to all relays, use RELAYS_ACTIVE_LOW_MASK instead if only some of
+ * them are (relay 1 being the LSB).
  */
 //#define RELAYS_ACTIVE_LOW
+//#define RELAYS_ACTIVE_LOW_MASK 0x00000000UL
 
 // Define to enable temperature-controlled relays
 #define ENABLE_THERMOMETER
@@ -41,15 +65,108 @@
 // Thermometer's data wire is connected to pin 5
 #define THERMOMETER_PIN 2
 
+// Maximum number of DS18B20 sensors on the bus
+#define MAX_SENSORS 4
+
 // DS18B20's data resolution
 #define THERMOMETER_RESOLUTION 9
 
-// Delay between temperature readings
-#define THERMO_READ_INTERVAL (5 * 1000U)
+/* Delay between temperature readings. Sensors are read every
+ * THERMO_MIN_INTERVAL while the temperature is within THERMO_NEAR_BAND of the
+ * point where any relay would switch, otherwise the delay is doubled at every
+ * reading, up to THERMO_MAX_INTERVAL.
+ */
+#define THERMO_MIN_INTERVAL (1 * 1000UL)
+#define THERMO_MAX_INTERVAL (60 * 1000UL)
+#define THERMO_NEAR_BAND 100				// Hundredths of degree
+
+// Times a reading is retried when it fails the CRC check
+#define THERMO_READ_RETRIES 2
+
+/* Define to collect timing statistics about loop() and the webserver, which
+ * will be available at /stats.html and, in Prometheus format, at /metrics.
+ * This is meant to help measuring the effect of changes to the code, so it is
+ * disabled by default.
+ *
+ * The histogram of loop() times has this many buckets, the first one being up
+ * to 64 us, the last one up to 64 us * 2^(STATS_HIST_BUCKETS - 1).
+ */
+//#define ENABLE_STATS
+#define STATS_HIST_BUCKETS 12
 
-// Totally useless at this time ;)
+/* Define to keep a history of temperature (as read by the first sensor) and
+ * relay states in RAM, available at /history.csv. Two resolutions are kept:
+ * HISTORY_FINE_LEN intervals of HISTORY_FINE_PERIOD each (1 hour by default)
+ * and HISTORY_COARSE_LEN intervals made of HISTORY_COARSE_RATIO fine intervals
+ * each (1 day by default). Every interval takes 5 bytes. The whole thing must
+ * fit in HISTORY_RAM_BUDGET bytes, which is checked at compile time. The budget
+ * is meant for AVR boards, elsewhere longs and alignment take a bit more.
+ *
+ * html/history.csv has one #HIST# tag for every row that can be exported, so
+ * run tools/html2h.py again after changing the lengths.
+ */
+#define ENABLE_HISTORY
+#define HISTORY_FINE_LEN 30
+#define HISTORY_FINE_PERIOD (2 * 60 * 1000UL)
+#define HISTORY_COARSE_LEN 48
+#define HISTORY_COARSE_RATIO 15
+#ifdef __AVR__
+#define HISTORY_RAM_BUDGET 432
+#else
+#define HISTORY_RAM_BUDGET 448
+#endif
+
+/* Define to keep the time of day through the Time library, which is not
+ * installed with the Arduino IDE, so this is disabled by default. There is no
+ * RTC, so the clock must be set through /api/time after every reboot.
+ */
 //#define USE_ARDUINO_TIME_LIBRARY
 
+/* Define to allow relays to follow a weekly schedule, with a resolution of 30
+ * minutes. This requires USE_ARDUINO_TIME_LIBRARY, so uncomment both to use
+ * schedules. Schedules are kept in EEPROM and take 43 bytes per relay, which
+ * moves whatever comes after them (i.e.: the options of relays 5 and up and
+ * the scenes), so check those after changing this.
+ */
+//#define ENABLE_SCHEDULE
+
+/* Define to enable named scenes and groups, see scenes.html. A scene stores
+ * the mode of every relay, a group is a set of relays to be put in the same
+ * mode. Both are applied at once and saved as a single record.
+ */
+#define ENABLE_SCENES
+#define MAX_SCENES 4
+#define MAX_GROUPS 4
+
+/* Define to publish the state of the relays and the temperature to an MQTT
+ * broker, and to accept commands from it, see README. This needs the
+ * PubSubClient library and is only supported on the WIZ5x00 and WiFi101
+ * network interfaces. Changes happening within MQTT_COALESCE_MS of each other
+ * are published together. Note that connecting to the broker blocks while it is
+ * unreachable, so attempts are only made every MQTT_RETRY_INTERVAL.
+ */
+//#define ENABLE_MQTT
+#define MQTT_BROKER_B1 192
+#define MQTT_BROKER_B2 168
+#define MQTT_BROKER_B3 1
+#define MQTT_BROKER_B4 2
+#define MQTT_PORT 1883
+#define MQTT_PREFIX "smartstrip"		// Also used as the client ID
+#define MQTT_COALESCE_MS 250
+#define MQTT_RETRY_INTERVAL (30 * 1000UL)
+
+/* Define to accept commands through the binary UDP protocol described in
+ * UdpControl.h, see also tools/udpctl.py. Like MQTT, this is only supported on
+ * the WIZ5x00 and WiFi101 network interfaces. If UDP_KEY (16 bytes) is
+ * defined, requests must be authenticated with it. In that case the sequence
+ * numbers of SET requests are also saved to EEPROM, once every
+ * UDP_SEQ_RESERVE of them, so that they can't be replayed after a reboot.
+ */
+//#define ENABLE_UDP
+#define UDP_PORT 5050
+//#define UDP_KEY 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+#define UDP_SEQ_RESERVE 256
+
 // Size of a MAC address (bytes)
 #define MAC_SIZE 6
 
@@ -58,15 +175,45 @@
 
 // EEPROM offsets
 #define EEPROM_MAGIC 0x50545353UL			// "SSTP"
-#define EEPROM_R1_PARAM_ADDR 4
-#define EEPROM_R2_PARAM_ADDR 20
-#define EEPROM_R3_PARAM_ADDR 36
-#define EEPROM_R4_PARAM_ADDR 52
+#define EEPROM_PARAM_SIZE 16				// Distance between the options of two relays
+#define EEPROM_R1_PARAM_ADDR 4				// Relays 1-4, the 4th only has 12 bytes before EEPROM_MAC_ADDR
 #define EEPROM_MAC_ADDR 64
-#define EEPROM_NETMODE_ADDR 70				// This has turned to 2 bytes in some recent version of Arduino
+#define EEPROM_NETMODE_ADDR 70				// 1 byte, followed by 1 unused (it used to be an enum)
 #define EEPROM_IP_ADDR 72
 #define EEPROM_NETMASK_ADDR 76
 #define EEPROM_GATEWAY_ADDR 80
+#define EEPROM_SCHEDULE_ADDR 84
+#ifdef ENABLE_SCHEDULE
+#define EEPROM_SCHEDULE_SIZE 43				// Per relay, see SCHEDULE_SIZE
+#else
+#define EEPROM_SCHEDULE_SIZE 0
+#endif
+#define EEPROM_R5_PARAM_ADDR (EEPROM_SCHEDULE_ADDR + RELAYS_NO * EEPROM_SCHEDULE_SIZE)	// Relays 5 and up
+#if RELAYS_NO > 4
+#define EEPROM_SCENES_ADDR (EEPROM_R5_PARAM_ADDR + (RELAYS_NO - 4) * EEPROM_PARAM_SIZE)
+#else
+#define EEPROM_SCENES_ADDR EEPROM_R5_PARAM_ADDR
+#endif
+#ifdef ENABLE_SCENES
+#define EEPROM_SCENE_SIZE (8 + (RELAYS_NO + 1) / 2 + 1)	// Name, modes and CRC
+#define EEPROM_GROUP_SIZE (8 + (RELAYS_NO + 7) / 8 + 1)	// Name, members and CRC
+#define EEPROM_SCENES_SIZE (MAX_SCENES * EEPROM_SCENE_SIZE + MAX_GROUPS * EEPROM_GROUP_SIZE)
+#else
+#define EEPROM_SCENES_SIZE 0
+#endif
+#define EEPROM_UDP_SEQ_ADDR (EEPROM_SCENES_ADDR + EEPROM_SCENES_SIZE)
+#if defined (ENABLE_UDP) && defined (UDP_KEY)
+#define EEPROM_UDP_SEQ_SIZE 5				// Sequence number and CRC
+#else
+#define EEPROM_UDP_SEQ_SIZE 0
+#endif
+#define EEPROM_JOURNAL_ADDR (EEPROM_UDP_SEQ_ADDR + EEPROM_UDP_SEQ_SIZE)
+// Journal takes all the rest
+
+/* Relay options are saved this long after they last changed, so that
+ * several changes in a row only cost a single EEPROM write.
+ */
+#define JOURNAL_FLUSH_DELAY (30 * 1000UL)
 
 
 
@@ -86,6 +233,7 @@
 #define DEFAULT_RELAY_UNITS TEMP_C
 #define DEFAULT_RELAY_HYSTERESIS 10				// Tenths of degrees
 #define DEFAULT_RELAY_DELAY 5					// Minutes
+#define DEFAULT_RELAY_SENSOR 0
 
 #define DEFAULT_MAC_ADDRESS_B1 0x00
 #define DEFAULT_MAC_ADDRESS_B2 0x11
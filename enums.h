@@ -20,11 +20,14 @@
 #ifndef _ENUMS_H_
 #define _ENUMS_H_
 
+#include "common.h"
+
 enum RelayMode {
 	RELMD_ON = 0,			// Always on
 	RELMD_OFF = 1,			// Always off
 	RELMD_GT = 2,			// On if T > Tthres
-	RELMD_LT = 3			// On if T < Tthres
+	RELMD_LT = 3,			// On if T < Tthres
+	RELMD_SCHEDULE = 4		// On when the weekly schedule says so
 };
 
 enum TemperatureUnits {
@@ -37,19 +40,43 @@ enum RelayState {
 	RELAY_ON = HIGH
 };
 
+// Bitmask with one bit per relay, relay 1 being the LSB
+#if RELAYS_NO <= 8
+typedef byte RelayMask;
+#elif RELAYS_NO <= 16
+typedef uint16_t RelayMask;
+#elif RELAYS_NO <= 32
+typedef uint32_t RelayMask;
+#else
+#error "At most 32 relays are supported"
+#endif
+
 enum NetworkMode {
 	NETMODE_DHCP = 0,
 	NETMODE_STATIC = 1
 };
 
-// If this is modified, please review the EEPROM offsets in common.h
-struct RelayOptions {
-	RelayMode mode;
-	RelayState state;
-	TemperatureUnits units;
+/* Bit-packed, so that it only takes 5 bytes of RAM per relay whatever the size
+ * of enums (packed is needed for that on 32-bit targets, where the bitfields
+ * would be aligned as ints). This is never copied to EEPROM as is, see
+ * RELAY_IMAGE_* in Relay.h.
+ */
+struct __attribute__ ((packed)) RelayOptions {
+	RelayMode mode: 3;
+	RelayState state: 1;
+	TemperatureUnits units: 1;
+	byte scheduled: 1;			// GT/LT only apply while the schedule is active
+
+	/* Not an option and never saved, but it fits here: whether a GT/LT relay
+	 * has switched on since its options were set, after which it only switches
+	 * on again past the hysteresis point.
+	 */
+	byte hysteresisActive: 1;
+
 	byte threshold;
-	byte hysteresis;
-	byte delay;
+	byte hysteresis;			// Tenths of degree
+	byte delay;					// Minutes
+	byte sensor;				// Index of the temperature sensor to follow
 };
 
 #endif
@@ -0,0 +1,208 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "Arduino.h"
+
+HardwareSerial Serial;
+
+static byte pins[NUM_DIGITAL_PINS];
+
+static unsigned long long monotonicMicros () {
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+// Like on the board, time starts when the program does
+static const unsigned long long startMicros = monotonicMicros ();
+
+/* unsigned long is 64 bits here, so unlike on the board these never wrap
+ * around, but the sketch only ever subtracts them anyway.
+ */
+unsigned long millis () {
+	return (monotonicMicros () - startMicros) / 1000;
+}
+
+unsigned long micros () {
+	return monotonicMicros () - startMicros;
+}
+
+void delay (unsigned long ms) {
+	usleep (ms * 1000);
+}
+
+void delayMicroseconds (unsigned int us) {
+	usleep (us);
+}
+
+void pinMode (uint8_t pin __attribute__ ((unused)), uint8_t mode __attribute__ ((unused))) {
+}
+
+void digitalWrite (uint8_t pin, uint8_t val) {
+	if (pin < NUM_DIGITAL_PINS)
+		pins[pin] = val;
+}
+
+int digitalRead (uint8_t pin) {
+	return pin < NUM_DIGITAL_PINS ? pins[pin] : LOW;
+}
+
+void shiftOut (uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t val) {
+	for (byte i = 0; i < 8; i++) {
+		byte bit = bitOrder == LSBFIRST ? i : 7 - i;
+		digitalWrite (dataPin, (val >> bit) & 0x01);
+		digitalWrite (clockPin, HIGH);
+		digitalWrite (clockPin, LOW);
+	}
+}
+
+
+/******************************************************************************
+ * Print                                                                      *
+ ******************************************************************************/
+
+size_t Print::write (const uint8_t *buffer, size_t size) {
+	size_t n = 0;
+
+	while (size--)
+		n += write (*buffer++);
+
+	return n;
+}
+
+size_t Print::write (const char *str) {
+	return str ? write (reinterpret_cast<const uint8_t *> (str), strlen (str)) : 0;
+}
+
+size_t Print::print (const __FlashStringHelper *s) {
+	return write (reinterpret_cast<const char *> (s));
+}
+
+size_t Print::print (const char *s) {
+	return write (s);
+}
+
+size_t Print::print (char c) {
+	return write (static_cast<uint8_t> (c));
+}
+
+size_t Print::print (unsigned char n, int base) {
+	return printNumber (n, base);
+}
+
+size_t Print::print (int n, int base) {
+	return print (static_cast<long> (n), base);
+}
+
+size_t Print::print (unsigned int n, int base) {
+	return printNumber (n, base);
+}
+
+size_t Print::print (long n, int base) {
+	if (base == DEC && n < 0)
+		return print ('-') + printNumber (-static_cast<unsigned long> (n), base);
+	else
+		return printNumber (n, base);
+}
+
+size_t Print::print (unsigned long n, int base) {
+	return printNumber (n, base);
+}
+
+size_t Print::print (double n, int digits) {
+	char buf[32];
+
+	snprintf (buf, sizeof (buf), "%.*f", digits, n);
+	return write (buf);
+}
+
+size_t Print::print (const Printable& x) {
+	return x.printTo (*this);
+}
+
+size_t Print::println () {
+	return write ("\r\n");
+}
+
+size_t Print::printNumber (unsigned long n, int base) {
+	char buf[8 * sizeof (n) + 1];
+	char *p = &buf[sizeof (buf) - 1];
+
+	*p = '\0';
+	do {
+		unsigned long digit = n % base;
+		n /= base;
+		*--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+	} while (n);
+
+	return write (p);
+}
+
+
+/******************************************************************************
+ * HardwareSerial                                                             *
+ ******************************************************************************/
+
+void HardwareSerial::begin (unsigned long baud __attribute__ ((unused))) {
+}
+
+size_t HardwareSerial::write (uint8_t c) {
+	fputc (c, stderr);
+	return 1;
+}
+
+int HardwareSerial::available () {
+	return 0;
+}
+
+int HardwareSerial::read () {
+	return -1;
+}
+
+
+/******************************************************************************
+ * IPAddress                                                                  *
+ ******************************************************************************/
+
+IPAddress::IPAddress () {
+	memset (bytes, 0, sizeof (bytes));
+}
+
+IPAddress::IPAddress (uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4) {
+	bytes[0] = b1;
+	bytes[1] = b2;
+	bytes[2] = b3;
+	bytes[3] = b4;
+}
+
+size_t IPAddress::printTo (Print& p) const {
+	size_t n = 0;
+
+	for (byte i = 0; i < 4; i++) {
+		if (i > 0)
+			n += p.print ('.');
+		n += p.print (bytes[i], DEC);
+	}
+
+	return n;
+}
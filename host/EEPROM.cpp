@@ -0,0 +1,79 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include <fcntl.h>
+#include <unistd.h>
+#include "EEPROM.h"
+
+EEPROMClass EEPROM;
+
+static uint8_t cells[EEPROM_MAX_LEN];
+static uint16_t len = E2END + 1;
+static int fd = -1;
+
+EEPROMClass::EEPROMClass (): writes (0) {
+	// Erased, at startup
+	memset (cells, 0xFF, sizeof (cells));
+}
+
+uint8_t EEPROMClass::read (int idx) {
+	return idx >= 0 && idx < len ? cells[idx] : 0xFF;
+}
+
+void EEPROMClass::write (int idx, uint8_t val) {
+	if (idx < 0 || idx >= len)
+		return;
+
+	cells[idx] = val;
+	++writes;
+
+	if (fd >= 0 && pwrite (fd, &val, 1, idx) != 1)
+		Serial.println (F("Cannot write EEPROM file"));
+}
+
+uint16_t EEPROMClass::length () {
+	return len;
+}
+
+void EEPROMClass::update (int idx, uint8_t val) {
+	if (read (idx) != val)
+		write (idx, val);
+}
+
+bool eepromOpen (const char *path) {
+	fd = open (path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		return false;
+
+	// A new or short file only gets the erased cells appended
+	ssize_t n = pread (fd, cells, len, 0);
+	if (n < 0)
+		return false;
+
+	return pwrite (fd, cells + n, len - n, n) == len - n;
+}
+
+void eepromClear () {
+	memset (cells, 0xFF, sizeof (cells));
+	EEPROM.writes = 0;
+}
+
+void eepromSetLength (uint16_t _len) {
+	len = _len <= EEPROM_MAX_LEN ? _len : EEPROM_MAX_LEN;
+}
@@ -0,0 +1,180 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "OneWire.h"
+
+#define CMD_CONVERT_T 0x44
+#define CMD_READ_SCRATCHPAD 0xBE
+#define CMD_WRITE_SCRATCHPAD 0x4E
+#define CMD_NONE -1
+
+#define DS18B20_FAMILY 0x28
+
+struct Device {
+	byte rom[8];
+	int celsius;				// Hundredths of degree
+	int converted;				// Same, as of the last conversion
+	byte config;
+	bool corrupt;				// Send a wrong CRC
+};
+
+static Device devices[ONEWIRE_MAX_DEVICES];
+static byte nDevices = 1;
+
+static void initDevices () {
+	static bool done = false;
+
+	if (!done) {
+		for (byte i = 0; i < ONEWIRE_MAX_DEVICES; i++) {
+			Device& d = devices[i];
+			d.rom[0] = DS18B20_FAMILY;
+			for (byte j = 1; j < 7; j++)
+				d.rom[j] = 0x10 * i + j;
+			d.rom[7] = OneWire::crc8 (d.rom, 7);
+			d.celsius = d.converted = 2150;
+			d.config = 0x7F;
+			d.corrupt = false;
+		}
+		done = true;
+	}
+}
+
+void oneWireSetDevices (byte n) {
+	nDevices = min (n, ONEWIRE_MAX_DEVICES);
+}
+
+void oneWireSetTemperature (byte device, int celsius) {
+	initDevices ();
+	if (device < ONEWIRE_MAX_DEVICES)
+		devices[device].celsius = celsius;
+}
+
+void oneWireSetCrcErrors (byte device, bool corrupt) {
+	initDevices ();
+	if (device < ONEWIRE_MAX_DEVICES)
+		devices[device].corrupt = corrupt;
+}
+
+OneWire::OneWire (uint8_t pin __attribute__ ((unused))): selected (-1), command (CMD_NONE),
+	readPos (sizeof (scratchpad)), searchPos (0) {
+}
+
+uint8_t OneWire::reset () {
+	initDevices ();
+	selected = -1;
+	command = CMD_NONE;
+	readPos = sizeof (scratchpad);
+
+	// Presence pulse
+	return nDevices > 0;
+}
+
+void OneWire::select (const uint8_t rom[8]) {
+	selected = -2;			// Nobody, unless the ROM matches
+	for (byte i = 0; i < nDevices; i++) {
+		if (memcmp (rom, devices[i].rom, 8) == 0)
+			selected = i;
+	}
+}
+
+void OneWire::skip () {
+	selected = -1;
+}
+
+void OneWire::write (uint8_t v, uint8_t power __attribute__ ((unused))) {
+	if (command == CMD_WRITE_SCRATCHPAD) {
+		// TH, TL, then the configuration register
+		if (++readPos == 3) {
+			for (byte i = 0; i < nDevices; i++) {
+				if (selected == -1 || selected == i)
+					devices[i].config = v;
+			}
+		}
+		return;
+	}
+
+	command = v;
+	switch (v) {
+		case CMD_CONVERT_T:
+			for (byte i = 0; i < nDevices; i++) {
+				if (selected == -1 || selected == i)
+					devices[i].converted = devices[i].celsius;
+			}
+			break;
+		case CMD_READ_SCRATCHPAD:
+			if (selected >= 0) {
+				const Device& d = devices[selected];
+				int16_t raw = static_cast<long> (d.converted) * 16 / 100;
+				memset (scratchpad, 0, sizeof (scratchpad));
+				scratchpad[0] = raw & 0xFF;
+				scratchpad[1] = (raw >> 8) & 0xFF;
+				scratchpad[4] = d.config;
+				scratchpad[8] = crc8 (scratchpad, 8) ^ (d.corrupt ? 0x01 : 0);
+				readPos = 0;
+			}
+			break;
+		case CMD_WRITE_SCRATCHPAD:
+			readPos = 0;
+			break;
+	}
+}
+
+uint8_t OneWire::read () {
+	// An idle bus reads as all ones
+	return readPos < sizeof (scratchpad) ? scratchpad[readPos++] : 0xFF;
+}
+
+uint8_t OneWire::read_bit () {
+	// Conversions are instantaneous
+	return 1;
+}
+
+void OneWire::depower () {
+}
+
+void OneWire::reset_search () {
+	searchPos = 0;
+}
+
+uint8_t OneWire::search (uint8_t *newAddr, bool search_mode __attribute__ ((unused))) {
+	initDevices ();
+	if (searchPos >= nDevices)
+		return 0;
+
+	memcpy (newAddr, devices[searchPos++].rom, 8);
+	return 1;
+}
+
+// Dallas/Maxim CRC8, as in the OneWire library
+uint8_t OneWire::crc8 (const uint8_t *addr, uint8_t len) {
+	uint8_t crc = 0;
+
+	while (len--) {
+		uint8_t inbyte = *addr++;
+		for (uint8_t i = 8; i; i--) {
+			uint8_t mix = (crc ^ inbyte) & 0x01;
+			crc >>= 1;
+			if (mix)
+				crc ^= 0x8C;
+			inbyte >>= 1;
+		}
+	}
+
+	return crc;
+}
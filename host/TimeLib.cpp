@@ -0,0 +1,67 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "TimeLib.h"
+
+static time_t base;
+static unsigned long baseMillis;
+
+time_t now () {
+	return base + (millis () - baseMillis) / 1000;
+}
+
+void setTime (time_t t) {
+	base = t;
+	baseMillis = millis ();
+}
+
+static struct tm split (time_t t) {
+	struct tm tm;
+
+	gmtime_r (&t, &tm);
+	return tm;
+}
+
+int hour (time_t t) {
+	return split (t).tm_hour;
+}
+
+int minute (time_t t) {
+	return split (t).tm_min;
+}
+
+int second (time_t t) {
+	return split (t).tm_sec;
+}
+
+int day (time_t t) {
+	return split (t).tm_mday;
+}
+
+int weekday (time_t t) {
+	return split (t).tm_wday + 1;
+}
+
+int month (time_t t) {
+	return split (t).tm_mon + 1;
+}
+
+int year (time_t t) {
+	return split (t).tm_year + 1900;
+}
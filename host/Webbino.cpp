@@ -0,0 +1,343 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include "Webbino.h"
+#include "WebbinoInterfaces/WIZ5x00.h"
+
+// Largest request accepted, headers included
+#define REQUEST_SIZE 1024
+
+// Replies are sent in chunks of this size, about a TCP segment
+#define SEND_BUFFER_SIZE 1460
+
+static uint16_t httpPort = 8080;
+
+
+/******************************************************************************
+ * PString                                                                    *
+ ******************************************************************************/
+
+PString::PString (char *_buf, size_t _size): buf (_buf), size (_size), pos (0) {
+	buf[0] = '\0';
+}
+
+size_t PString::write (uint8_t c) {
+	if (pos + 1 >= size)
+		return 0;
+
+	buf[pos++] = c;
+	buf[pos] = '\0';
+	return 1;
+}
+
+void PString::begin () {
+	pos = 0;
+	buf[0] = '\0';
+}
+
+
+/******************************************************************************
+ * HTTPRequestParser                                                          *
+ ******************************************************************************/
+
+void HTTPRequestParser::parse (const char *_url) {
+	strncpy (url, _url, MAX_URL_LEN - 1);
+	url[MAX_URL_LEN - 1] = '\0';
+}
+
+char *HTTPRequestParser::get_basename () {
+	size_t len = strcspn (url, "?");
+
+	memcpy (buffer, url, len);
+	buffer[len] = '\0';
+
+	return buffer;
+}
+
+char *HTTPRequestParser::get_parameter (const __FlashStringHelper *name) {
+	return get_parameter (reinterpret_cast<const char *> (name));
+}
+
+char *HTTPRequestParser::get_parameter (const char *name) {
+	size_t nameLen = strlen (name);
+	const char *p = strchr (url, '?');
+
+	buffer[0] = '\0';
+	while (p) {
+		++p;
+		if (strncmp (p, name, nameLen) == 0 && p[nameLen] == '=') {
+			p += nameLen + 1;
+			size_t len = strcspn (p, "&");
+			memcpy (buffer, p, len);
+			buffer[len] = '\0';
+			break;
+		}
+		p = strchr (p, '&');
+	}
+
+	return buffer;
+}
+
+
+/******************************************************************************
+ * NetworkInterface                                                           *
+ ******************************************************************************/
+
+IPAddress NetworkInterface::getIP () {
+	return ip;
+}
+
+IPAddress NetworkInterface::getNetmask () {
+	return netmask;
+}
+
+IPAddress NetworkInterface::getGateway () {
+	return gateway;
+}
+
+const byte *NetworkInterface::getMAC () {
+	return mac;
+}
+
+boolean NetworkInterfaceWIZ5x00::begin (byte *_mac) {
+	memcpy (mac, _mac, sizeof (mac));
+	ip = IPAddress (127, 0, 0, 1);
+	netmask = IPAddress (255, 0, 0, 0);
+	gateway = IPAddress (127, 0, 0, 1);
+
+	return true;
+}
+
+boolean NetworkInterfaceWIZ5x00::begin (byte *_mac, byte *_ip, byte *_dns __attribute__ ((unused)), byte *_gw, byte *_mask) {
+	memcpy (mac, _mac, sizeof (mac));
+	ip = IPAddress (_ip[0], _ip[1], _ip[2], _ip[3]);
+	netmask = IPAddress (_mask[0], _mask[1], _mask[2], _mask[3]);
+	gateway = IPAddress (_gw[0], _gw[1], _gw[2], _gw[3]);
+
+	return true;
+}
+
+
+/******************************************************************************
+ * WebServer                                                                  *
+ ******************************************************************************/
+
+// Buffers the reply, so that it does not go out a byte at a time
+class SocketPrint: public Print {
+public:
+	SocketPrint (int _fd): fd (_fd), len (0) {
+	}
+
+	~SocketPrint () {
+		flush ();
+	}
+
+	size_t write (uint8_t c) override {
+		if (len == sizeof (buf))
+			flush ();
+		buf[len++] = c;
+		return 1;
+	}
+
+	using Print::write;
+
+	void flush () {
+		size_t sent = 0;
+
+		while (sent < len) {
+			ssize_t n = send (fd, buf + sent, len - sent, MSG_NOSIGNAL);
+			if (n <= 0)
+				break;
+			sent += n;
+		}
+		len = 0;
+	}
+
+private:
+	int fd;
+	char buf[SEND_BUFFER_SIZE];
+	size_t len;
+};
+
+static PGM_P contentType (const char *name) {
+	const char *ext = strrchr (name, '.');
+
+	if (ext && strcmp (ext, ".html") == 0)
+		return "text/html";
+	else if (ext && strcmp (ext, ".csv") == 0)
+		return "text/csv";
+	else
+		return "text/plain";
+}
+
+void WebServer::setPort (uint16_t port) {
+	httpPort = port;
+}
+
+WebServer::WebServer (): listenFd (-1), pages (NULL), substitutions (NULL) {
+}
+
+boolean WebServer::begin (NetworkInterface& netint __attribute__ ((unused)), const Page * const _pages[], const ReplacementTag * const _substitutions[]) {
+	struct sockaddr_in addr;
+	int one = 1;
+
+	pages = _pages;
+	substitutions = _substitutions;
+
+	listenFd = socket (AF_INET, SOCK_STREAM, 0);
+	if (listenFd < 0)
+		return false;
+
+	setsockopt (listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
+
+	memset (&addr, 0, sizeof (addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons (httpPort);
+	addr.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+	if (bind (listenFd, reinterpret_cast<struct sockaddr *> (&addr), sizeof (addr)) < 0 || listen (listenFd, 16) < 0) {
+		// The sketch does not check this, and would just sit there
+		perror ("Cannot listen for HTTP requests");
+		exit (1);
+	}
+
+	// loop() must never wait for a client
+	fcntl (listenFd, F_SETFL, O_NONBLOCK);
+
+	return true;
+}
+
+const Page *WebServer::findPage (const char *name) const {
+	for (byte i = 0; pages[i]; i++) {
+		if (strcmp_P (name, pages[i] -> name) == 0)
+			return pages[i];
+	}
+
+	return NULL;
+}
+
+// A linear scan, which is what Webbino does
+const ReplacementTag *WebServer::findTag (const char *name) const {
+	for (unsigned int i = 0; substitutions && substitutions[i]; i++) {
+		if (strcmp_P (name, substitutions[i] -> name) == 0)
+			return substitutions[i];
+	}
+
+	return NULL;
+}
+
+void WebServer::sendPage (int fd, HTTPRequestParser& request) {
+	SocketPrint out (fd);
+	const char *name = request.get_basename ();
+
+	if (strcmp (name, "/") == 0)
+		name = "/index.html";
+
+	const Page *page = findPage (name);
+	if (!page) {
+		out.print (F("HTTP/1.0 404 Not Found\r\nContent-Type: text/plain\r\nConnection: close\r\n\r\nNot found\r\n"));
+		return;
+	}
+
+	// name points to the parser buffer, which the page function might reuse
+	PGM_P type = contentType (page -> name);
+	if (page -> function)
+		page -> function (request);
+
+	out.print (F("HTTP/1.0 200 OK\r\nServer: Webbino " WEBBINO_VERSION "\r\nConnection: close\r\nContent-Type: "));
+	out.print (type);
+	out.print (F("\r\n\r\n"));
+
+	for (PGM_P p = page -> content; *p; ) {
+		if (*p == '#') {
+			PGM_P end = p + 1;
+			while (*end && *end != '#' && end - p <= MAX_TAG_LEN)
+				++end;
+
+			if (*end == '#' && end > p + 1) {
+				char tag[MAX_TAG_LEN + 1];
+				memcpy (tag, p + 1, end - p - 1);
+				tag[end - p - 1] = '\0';
+
+				const ReplacementTag *sub = findTag (tag);
+				if (strncmp (tag, "GETP_", 5) == 0) {
+					// Built-in: value of a query string parameter
+					out.print (request.get_parameter (tag + 5));
+					p = end + 1;
+					continue;
+				} else if (sub) {
+					PString& value = sub -> function (sub -> data);
+					out.print (static_cast<const char *> (value));
+					value.begin ();
+					p = end + 1;
+					continue;
+				}
+			}
+		}
+
+		out.write (*p++);
+	}
+}
+
+boolean WebServer::loop () {
+	char req[REQUEST_SIZE];
+	size_t len = 0;
+
+	int fd = accept (listenFd, NULL, NULL);
+	if (fd < 0)
+		return false;
+
+	// Don't get stuck on a client that never sends its request
+	struct timeval tv = {1, 0};
+	int one = 1;
+	fcntl (fd, F_SETFL, 0);
+	setsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof (tv));
+	setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof (one));
+
+	// Only the request line matters, but the headers are read too
+	while (len < sizeof (req) - 1) {
+		ssize_t n = recv (fd, req + len, sizeof (req) - 1 - len, 0);
+		if (n <= 0)
+			break;
+		len += n;
+		req[len] = '\0';
+		if (strstr (req, "\r\n\r\n"))
+			break;
+	}
+	req[len] = '\0';
+
+	char *method = strtok (req, " ");
+	char *url = strtok (NULL, " \r\n");
+	if (method && url && strcmp (method, "GET") == 0) {
+		HTTPRequestParser request;
+		request.parse (url);
+		sendPage (fd, request);
+	}
+
+	close (fd);
+
+	return true;
+}
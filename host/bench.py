@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+#
+# This file is part of SmartStrip.
+#
+# Copyright (C) 2012-2016 by SukkoPera
+#
+# SmartStrip is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# SmartStrip is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.
+
+"""HTTP load benchmark for SmartStrip.
+
+Starts the host build on a free port, with a fresh EEPROM, and fetches the
+main pages over and over, one at a time as the sketch serves them:
+
+    python3 bench.py --server build/smartstrip
+
+or measures a real board instead:
+
+    python3 bench.py --host 192.168.1.42
+
+For every page the number of requests per second is printed, together with
+the median and 99th percentile of the response time. Then the loop() and
+webserver times are read from /stats.html, which is reset before starting
+(this needs ENABLE_STATS, which the host build always has).
+
+With --check every page is only fetched once and the script fails if any of
+them does not come back with 200 OK, which is what "make test" uses.
+"""
+
+import argparse
+import os
+import re
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+PAGES = ["/main.html", "/sck.html?rel=%d", "/net.html"]
+
+def percentile (values, p):
+	k = (len (values) - 1) * p / 100
+	return values[int (round (k))]
+
+def fetch (host, port, path, timeout = 5.0):
+	"""Returns the status code and the body, reading until the connection is
+	closed, as Webbino does not send Content-Length.
+	"""
+	sock = socket.create_connection ((host, port), timeout = timeout)
+	try:
+		sock.sendall (("GET %s HTTP/1.0\r\nHost: %s\r\n\r\n" % (path, host)).encode ("ascii"))
+		chunks = []
+		while True:
+			data = sock.recv (4096)
+			if not data:
+				break
+			chunks.append (data)
+	finally:
+		sock.close ()
+
+	response = b"".join (chunks)
+	head, _, body = response.partition (b"\r\n\r\n")
+	status = head.split (b" ", 2)
+	if len (status) < 2 or not status[1].isdigit ():
+		raise ValueError ("Bad response to %s" % path)
+	return int (status[1]), body
+
+def free_port ():
+	sock = socket.socket ()
+	sock.bind (("127.0.0.1", 0))
+	port = sock.getsockname ()[1]
+	sock.close ()
+	return port
+
+def start_server (binary, port, eeprom):
+	proc = subprocess.Popen ([binary, "-p", str (port), "-e", eeprom], stderr = subprocess.DEVNULL)
+	deadline = time.monotonic () + 5
+	while time.monotonic () < deadline:
+		if proc.poll () is not None:
+			raise RuntimeError ("%s exited with code %d" % (binary, proc.returncode))
+		try:
+			socket.create_connection (("127.0.0.1", port), timeout = 0.2).close ()
+			return proc
+		except OSError:
+			time.sleep (0.05)
+	proc.kill ()
+	raise RuntimeError ("%s did not start listening" % binary)
+
+def bench_page (host, port, path, n):
+	times = []
+	start = time.perf_counter ()
+	for _ in range (n):
+		t0 = time.perf_counter ()
+		status, _ = fetch (host, port, path)
+		times.append ((time.perf_counter () - t0) * 1000)
+		if status != 200:
+			raise ValueError ("%s returned %d" % (path, status))
+	total = time.perf_counter () - start
+
+	times.sort ()
+	print ("%-20s %8.1f req/s   p50 %7.2f ms   p99 %7.2f ms" % (
+		path, n / total, percentile (times, 50), percentile (times, 99)))
+
+def show_stats (host, port):
+	_, body = fetch (host, port, "/stats.html")
+	text = body.decode ("ascii", "replace")
+	for label in ("Loop iterations", "Loop time", "Webserver time"):
+		m = re.search (r"<td>(%s[^<]*)</td><td>([^<]*)</td>" % label, text)
+		if m:
+			print ("%-30s %s" % (m.group (1), m.group (2)))
+
+def run (host, port, args):
+	paths = [p % args.relay if "%d" in p else p for p in PAGES]
+
+	if args.check:
+		ok = True
+		for path in paths + ["/", "/api/state", "/stats.html"]:
+			status, _ = fetch (host, port, path)
+			print ("%-20s %d" % (path, status))
+			ok = ok and status == 200
+		status, _ = fetch (host, port, "/nonexistent.html")
+		print ("%-20s %d" % ("/nonexistent.html", status))
+		return ok and status == 404
+
+	fetch (host, port, "/stats.html?reset=1")
+	for path in paths:
+		bench_page (host, port, path, args.n)
+	show_stats (host, port)
+	return True
+
+def main ():
+	parser = argparse.ArgumentParser (description = "Benchmark the SmartStrip web interface")
+	where = parser.add_mutually_exclusive_group (required = True)
+	where.add_argument ("--server", help = "host build to start")
+	where.add_argument ("--host", help = "address of a running SmartStrip")
+	parser.add_argument ("-p", "--port", type = int, default = 80, help = "port, with --host")
+	parser.add_argument ("-n", type = int, default = 500, help = "requests per page")
+	parser.add_argument ("-r", "--relay", type = int, default = 1, help = "relay to use for /sck.html")
+	parser.add_argument ("--check", action = "store_true", help = "only check that all pages are served")
+	args = parser.parse_args ()
+
+	if args.host:
+		return 0 if run (args.host, args.port, args) else 1
+
+	port = free_port ()
+	with tempfile.TemporaryDirectory () as tmp:
+		proc = start_server (args.server, port, os.path.join (tmp, "eeprom.bin"))
+		try:
+			return 0 if run ("127.0.0.1", port, args) else 1
+		finally:
+			proc.kill ()
+			proc.wait ()
+
+if __name__ == "__main__":
+	sys.exit (main ())
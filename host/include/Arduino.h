@@ -0,0 +1,197 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Minimal stand-in for the Arduino core, just enough to build SmartStrip on a
+ * Linux host (see host/README). Flash is ordinary memory here, so all the
+ * PROGMEM machinery boils down to plain pointer accesses.
+ */
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+#define PROGMEM
+typedef const char *PGM_P;
+#define PSTR(s) (s)
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *> (s))
+
+// These read the first bytes of whatever is there, like on the board
+static inline uint8_t pgm_read_byte (const void *p) {
+	return *static_cast<const uint8_t *> (p);
+}
+
+static inline uint16_t pgm_read_word (const void *p) {
+	uint16_t x;
+	memcpy (&x, p, sizeof (x));
+	return x;
+}
+
+static inline uint32_t pgm_read_dword (const void *p) {
+	uint32_t x;
+	memcpy (&x, p, sizeof (x));
+	return x;
+}
+
+#define pgm_read_ptr(p) (*(void * const *) (p))
+
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strstr_P strstr
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcat_P strcat
+#define memcpy_P memcpy
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define DEC 10
+#define HEX 16
+
+#define LED_BUILTIN 13
+
+// Number of simulated pins
+#define NUM_DIGITAL_PINS 20
+
+#define noInterrupts()
+#define interrupts()
+
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+unsigned long millis ();
+unsigned long micros ();
+void delay (unsigned long ms);
+void delayMicroseconds (unsigned int us);
+
+void pinMode (uint8_t pin, uint8_t mode);
+void digitalWrite (uint8_t pin, uint8_t val);
+int digitalRead (uint8_t pin);
+void shiftOut (uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t val);
+
+class Print;
+
+class Printable {
+public:
+	virtual ~Printable () {}
+	virtual size_t printTo (Print& p) const = 0;
+};
+
+class Print {
+public:
+	virtual ~Print () {}
+
+	virtual size_t write (uint8_t c) = 0;
+	virtual size_t write (const uint8_t *buffer, size_t size);
+	size_t write (const char *str);
+
+	size_t print (const __FlashStringHelper *s);
+	size_t print (const char *s);
+	size_t print (char c);
+	size_t print (unsigned char n, int base = DEC);
+	size_t print (int n, int base = DEC);
+	size_t print (unsigned int n, int base = DEC);
+	size_t print (long n, int base = DEC);
+	size_t print (unsigned long n, int base = DEC);
+	size_t print (double n, int digits = 2);
+	size_t print (const Printable& x);
+
+	size_t println ();
+	template <typename T>
+	size_t println (T x) {
+		size_t n = print (x);
+		return n + println ();
+	}
+	template <typename T>
+	size_t println (T x, int arg) {
+		size_t n = print (x, arg);
+		return n + println ();
+	}
+
+private:
+	size_t printNumber (unsigned long n, int base);
+};
+
+class Stream: public Print {
+public:
+	virtual int available () = 0;
+	virtual int read () = 0;
+};
+
+// Writes to stderr, reads nothing
+class HardwareSerial: public Stream {
+public:
+	void begin (unsigned long baud);
+	size_t write (uint8_t c) override;
+	using Print::write;
+	int available () override;
+	int read () override;
+
+	operator bool () {
+		return true;
+	}
+};
+
+extern HardwareSerial Serial;
+
+class IPAddress: public Printable {
+public:
+	IPAddress ();
+	IPAddress (uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4);
+
+	uint8_t operator[] (int i) const {
+		return bytes[i];
+	}
+
+	uint8_t& operator[] (int i) {
+		return bytes[i];
+	}
+
+	bool operator== (const IPAddress& other) const {
+		return memcmp (bytes, other.bytes, sizeof (bytes)) == 0;
+	}
+
+	size_t printTo (Print& p) const override;
+
+private:
+	uint8_t bytes[4];
+};
+
+#endif
@@ -0,0 +1,81 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* EEPROM stand-in: E2END + 1 bytes of RAM, initially erased (0xFF), optionally
+ * backed by a file so that settings survive a restart (see eepromOpen()).
+ */
+
+#ifndef _HOST_EEPROM_H_
+#define _HOST_EEPROM_H_
+
+#include <Arduino.h>
+
+#ifndef E2END
+#define E2END 1023				// As on an ATmega328
+#endif
+
+// Largest size that can be simulated with eepromSetLength(), as on a Mega
+#define EEPROM_MAX_LEN 4096
+
+class EEPROMClass {
+public:
+	EEPROMClass ();
+
+	uint8_t read (int idx);
+	void write (int idx, uint8_t val);
+	void update (int idx, uint8_t val);
+
+	uint16_t length ();
+
+	template <typename T>
+	T& get (int idx, T& t) {
+		uint8_t *p = reinterpret_cast<uint8_t *> (&t);
+		for (size_t i = 0; i < sizeof (T); i++)
+			p[i] = read (idx + i);
+		return t;
+	}
+
+	template <typename T>
+	const T& put (int idx, const T& t) {
+		const uint8_t *p = reinterpret_cast<const uint8_t *> (&t);
+		for (size_t i = 0; i < sizeof (T); i++)
+			update (idx + i, p[i]);
+		return t;
+	}
+
+	// Number of actual writes, i.e. of cells worn
+	unsigned long writes;
+};
+
+extern EEPROMClass EEPROM;
+
+/* Loads the contents from path, if it exists, and writes every change back to
+ * it from then on. Returns false if the file cannot be used.
+ */
+bool eepromOpen (const char *path);
+
+// Erases everything, e.g. between tests
+void eepromClear ();
+
+/* Makes the EEPROM look len bytes long (E2END + 1 by default) from now on, to
+ * test how sizes other than the one the sketch was built for are handled.
+ */
+void eepromSetLength (uint16_t len);
+
+#endif
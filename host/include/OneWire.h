@@ -0,0 +1,67 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* OneWire stand-in, with DS18B20 sensors simulated on the bus. They convert
+ * instantly and report whatever temperature was last set for them. Setting
+ * the number of sensors to 0 simulates a bus where nobody answers.
+ */
+
+#ifndef _HOST_ONEWIRE_H_
+#define _HOST_ONEWIRE_H_
+
+#include <Arduino.h>
+
+// Sensors that can be put on the simulated bus
+#define ONEWIRE_MAX_DEVICES 8
+
+class OneWire {
+public:
+	OneWire (uint8_t pin);
+
+	uint8_t reset ();
+	void select (const uint8_t rom[8]);
+	void skip ();
+	void write (uint8_t v, uint8_t power = 0);
+	uint8_t read ();
+	uint8_t read_bit ();
+	void depower ();
+
+	void reset_search ();
+	uint8_t search (uint8_t *newAddr, bool search_mode = true);
+
+	static uint8_t crc8 (const uint8_t *addr, uint8_t len);
+
+private:
+	int selected;				// -1 for all
+	int command;
+	byte scratchpad[9];
+	byte readPos;
+	byte searchPos;
+};
+
+// Sets how many sensors are on the bus, this must be called before begin()
+void oneWireSetDevices (byte n);
+
+// Temperature reported by a sensor from its next conversion, in 1/100 of *C
+void oneWireSetTemperature (byte device, int celsius);
+
+// Makes a sensor return its scratchpad with a wrong CRC, or stop doing that
+void oneWireSetCrcErrors (byte device, bool corrupt);
+
+#endif
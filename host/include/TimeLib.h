@@ -0,0 +1,41 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Stand-in for the Time library: the clock starts at 0 (i.e. unset) like on
+ * the board, and setTime() makes it run from the given time on.
+ */
+
+#ifndef _HOST_TIMELIB_H_
+#define _HOST_TIMELIB_H_
+
+#include <time.h>
+#include <Arduino.h>
+
+time_t now ();
+void setTime (time_t t);
+
+int hour (time_t t);
+int minute (time_t t);
+int second (time_t t);
+int day (time_t t);
+int weekday (time_t t);			// Sunday is 1
+int month (time_t t);
+int year (time_t t);
+
+#endif
@@ -0,0 +1,47 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Stand-in for the UDP interface of the Arduino core, which the Ethernet and
+ * WiFi libraries implement. Only what UdpControl uses is here.
+ */
+
+#ifndef _HOST_UDP_H_
+#define _HOST_UDP_H_
+
+#include <Arduino.h>
+
+class UDP: public Stream {
+public:
+	virtual uint8_t begin (uint16_t port) = 0;
+
+	// Size of the next datagram, 0 if there is none
+	virtual int parsePacket () = 0;
+	virtual int read (unsigned char *buffer, size_t len) = 0;
+	using Stream::read;
+
+	virtual int beginPacket (IPAddress ip, uint16_t port) = 0;
+	virtual size_t write (const uint8_t *buffer, size_t size) = 0;
+	using Print::write;
+	virtual int endPacket () = 0;
+
+	virtual IPAddress remoteIP () = 0;
+	virtual uint16_t remotePort () = 0;
+};
+
+#endif
@@ -0,0 +1,133 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Stand-in for Webbino, with the same interface the sketch uses, serving
+ * pages over a plain TCP socket. Like the real thing it handles one request
+ * per call to WebServer::loop(), calls the page function, then sends the page
+ * with its #TAGS# replaced, looking each one up in the substitutions table.
+ */
+
+#ifndef _HOST_WEBBINO_H_
+#define _HOST_WEBBINO_H_
+
+#include <Arduino.h>
+
+#define WEBBINO_VERSION "host"
+
+#define ENABLE_TAGS
+#define WEBBINO_USE_WIZ5100
+
+#define MAX_URL_LEN 128
+#define MAX_TAG_LEN 24
+
+// Print to a fixed buffer, as in the PString library
+class PString: public Print {
+public:
+	PString (char *buf, size_t size);
+
+	size_t write (uint8_t c) override;
+	using Print::write;
+
+	void begin ();
+
+	size_t length () const {
+		return pos;
+	}
+
+	operator const char * () const {
+		return buf;
+	}
+
+private:
+	char *buf;
+	size_t size;
+	size_t pos;
+};
+
+class HTTPRequestParser {
+public:
+	char url[MAX_URL_LEN];
+
+	// Sets url, truncating it if needed
+	void parse (const char *_url);
+
+	// The url without the query string
+	char *get_basename ();
+
+	/* Value of a parameter of the query string, as it is (i.e. not decoded),
+	 * or an empty string. The same buffer is returned every time.
+	 */
+	char *get_parameter (const __FlashStringHelper *name);
+	char *get_parameter (const char *name);
+
+private:
+	char buffer[MAX_URL_LEN];
+};
+
+typedef void (*PageFunction) (HTTPRequestParser& request);
+
+struct Page {
+	PGM_P name;
+	PGM_P content;
+	PageFunction function;
+};
+
+typedef PString& (*var_evaluate_func) (void *data);
+
+struct ReplacementTag {
+	PGM_P name;
+	var_evaluate_func function;
+	void *data;
+};
+
+class NetworkInterface {
+public:
+	IPAddress getIP ();
+	IPAddress getNetmask ();
+	IPAddress getGateway ();
+	const byte *getMAC ();
+
+protected:
+	byte mac[6];
+	IPAddress ip, netmask, gateway;
+};
+
+class WebServer {
+public:
+	WebServer ();
+
+	boolean begin (NetworkInterface& netint, const Page * const _pages[], const ReplacementTag * const _substitutions[]);
+
+	// Serves at most one request, returns true if it did
+	boolean loop ();
+
+	// Host only: TCP port to listen on, to be set before begin()
+	static void setPort (uint16_t port);
+
+private:
+	int listenFd;
+	const Page * const *pages;
+	const ReplacementTag * const *substitutions;
+
+	const Page *findPage (const char *name) const;
+	const ReplacementTag *findTag (const char *name) const;
+	void sendPage (int fd, HTTPRequestParser& request);
+};
+
+#endif
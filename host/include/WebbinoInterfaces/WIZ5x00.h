@@ -0,0 +1,32 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef _HOST_WIZ5X00_H_
+#define _HOST_WIZ5X00_H_
+
+#include <Webbino.h>
+
+// Nothing to set up, the host network is used as it is
+class NetworkInterfaceWIZ5x00: public NetworkInterface {
+public:
+	boolean begin (byte *_mac);
+	boolean begin (byte *_mac, byte *_ip, byte *_dns, byte *_gw, byte *_mask);
+};
+
+#endif
@@ -0,0 +1,72 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Runs the sketch on the host: setup() once, then loop() forever, like the
+ * Arduino core does.
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <OneWire.h>
+#include <Webbino.h>
+
+void setup ();
+void loop ();
+
+static void usage (const char *argv0) {
+	fprintf (stderr, "Usage: %s [-p PORT] [-e EEPROM_FILE] [-s SENSORS] [-t CELSIUS]\n", argv0);
+	fprintf (stderr, "  -p PORT         HTTP port, on localhost (default: 8080)\n");
+	fprintf (stderr, "  -e EEPROM_FILE  keep the EEPROM contents in this file (default: none)\n");
+	fprintf (stderr, "  -s SENSORS      number of simulated DS18B20 sensors (default: 1)\n");
+	fprintf (stderr, "  -t CELSIUS      temperature they report (default: 21.5)\n");
+}
+
+int main (int argc, char *argv[]) {
+	int opt;
+
+	while ((opt = getopt (argc, argv, "p:e:s:t:h")) != -1) {
+		switch (opt) {
+			case 'p':
+				WebServer::setPort (atoi (optarg));
+				break;
+			case 'e':
+				if (!eepromOpen (optarg)) {
+					perror (optarg);
+					return 1;
+				}
+				break;
+			case 's':
+				oneWireSetDevices (atoi (optarg));
+				break;
+			case 't':
+				for (byte i = 0; i < ONEWIRE_MAX_DEVICES; i++)
+					oneWireSetTemperature (i, atof (optarg) * 100);
+				break;
+			default:
+				usage (argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	setup ();
+	for (;;)
+		loop ();
+}
@@ -0,0 +1,116 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Tests for the journal: options must survive a reboot however many times the
+ * ring wraps, and a save that changes nothing must not touch the EEPROM.
+ */
+
+#include <EEPROM.h>
+#include "common.h"
+#include "Journal.h"
+#ifdef ENABLE_SCENES
+#include "Scenes.h"
+#endif
+#include "check.h"
+
+static Relay relays[RELAYS_NO];
+
+// Formats an EEPROM of the given size, as checkAndFormatEEPROM() does
+static void format (uint16_t len) {
+	eepromClear ();
+	eepromSetLength (len);
+
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		relays[i].id = i + 1;
+		relays[i].setDefaults ();
+		relays[i].writeOptions ();
+	}
+
+	Journal journal;
+	journal.format ();
+#ifdef ENABLE_SCENES
+	Scenes::format ();
+#endif
+}
+
+// Loads everything from the EEPROM, as setup() does
+static void boot (Journal& journal) {
+	for (byte i = 0; i < RELAYS_NO; i++) {
+		relays[i].id = i + 1;
+		relays[i].readOptions ();
+	}
+#ifdef ENABLE_SCENES
+	Scenes::begin ();
+#endif
+	journal.begin (relays);
+}
+
+static void save (Journal& journal, byte id, byte threshold) {
+	relays[id - 1].threshold = threshold;
+	journal.markDirty (id);
+	journal.flush ();
+}
+
+/* With 256 slots every record would be followed by one with the next sequence
+ * number once the ring is full, so the head could not be found.
+ */
+static void testManySlots () {
+	format (EEPROM_JOURNAL_ADDR + 256 * 8);
+
+	Journal journal;
+	boot (journal);
+	for (int n = 0; n < 1000; n++)
+		save (journal, 1 + n % RELAYS_NO, n % 200);
+
+	Journal rebooted;
+	boot (rebooted);
+	for (byte i = 0; i < RELAYS_NO; i++)
+		CHECK (relays[i].threshold == (1000 - RELAYS_NO + i) % 200);
+}
+
+/* The ring has a slot per relay, and the one after the head holds the only
+ * record of relay 2. Saving relay 1 unchanged must leave it alone.
+ */
+static void testUnchangedSave () {
+	format (EEPROM_JOURNAL_ADDR + RELAYS_NO * 8);
+
+	Journal journal;
+	boot (journal);
+	save (journal, 2, 30);
+	for (byte n = 1; n < RELAYS_NO; n++)
+		save (journal, 1, 30 + n);
+
+	unsigned long writes = EEPROM.writes;
+	journal.markDirty (1);
+	journal.flush ();
+	CHECK (EEPROM.writes == writes);
+	CHECK (journal.changesCoalesced == 1);
+
+	Journal rebooted;
+	boot (rebooted);
+	CHECK (relays[0].threshold == 30 + RELAYS_NO - 1);
+	CHECK (relays[1].threshold == 30);
+}
+
+int main () {
+	testManySlots ();
+	testUnchangedSave ();
+
+	return CHECK_RESULT ();
+}
@@ -0,0 +1,302 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Tests for bindQuery(): a few hand-picked query strings, then lots of random
+ * ones, which must never make it write outside of the destination struct or
+ * store values that are out of range.
+ *
+ * With --bench [N], it instead times N bindings of a whole form against the
+ * get_parameter() calls and tokenizing that the page functions used to do.
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <chrono>
+#include <Webbino.h>
+#include "QueryBinder.h"
+#include "check.h"
+
+struct Form {
+	byte mac[6];
+	byte mode;
+	byte ip[4];
+	int n;
+	char name[6];
+	uint32_t list;
+	unsigned long u;
+	int time;
+};
+
+const char ON_STR[] PROGMEM = "on";
+const char OFF_STR[] PROGMEM = "off";
+const char STATIC_STR[] PROGMEM = "static";
+PGM_P const choices[] PROGMEM = {ON_STR, OFF_STR, STATIC_STR};
+
+const char MAC_STR[] PROGMEM = "mac";
+const char MODE_STR[] PROGMEM = "mode";
+const char IP_STR[] PROGMEM = "ip";
+const char N_STR[] PROGMEM = "n";
+const char FLAG_STR[] PROGMEM = "flag";
+const char NAME_STR[] PROGMEM = "name";
+const char LIST_STR[] PROGMEM = "list";
+const char U_STR[] PROGMEM = "u";
+const char TIME_STR[] PROGMEM = "time";
+
+#define P_MAC PARAM_BIT (0)
+#define P_MODE PARAM_BIT (1)
+#define P_IP PARAM_BIT (2)
+#define P_N PARAM_BIT (3)
+#define P_FLAG PARAM_BIT (4)
+#define P_NAME PARAM_BIT (5)
+#define P_LIST PARAM_BIT (6)
+#define P_U PARAM_BIT (7)
+#define P_TIME PARAM_BIT (8)
+
+const ParamSpec specs[] PROGMEM = {
+	{MAC_STR, PARAM_MAC, offsetof (Form, mac), 0, 0, NULL},
+	{MODE_STR, PARAM_CHOICE, offsetof (Form, mode), 0, 3, choices},
+	{IP_STR, PARAM_IPV4, offsetof (Form, ip), 0, 0, NULL},
+	{N_STR, PARAM_INT, offsetof (Form, n), -5, 300, NULL},
+	{FLAG_STR, PARAM_FLAG, 0, 0, 0, NULL},
+	{NAME_STR, PARAM_TEXT, offsetof (Form, name), 0, 5, NULL},
+	{LIST_STR, PARAM_LIST, offsetof (Form, list), 1, 20, NULL},
+	{U_STR, PARAM_ULONG, offsetof (Form, u), 0, 0, NULL},
+	{TIME_STR, PARAM_TIME, offsetof (Form, time), 60, 24 * 60, NULL}
+};
+
+#define SPECS_NO (sizeof (specs) / sizeof (specs[0]))
+
+// Fills the form with junk, then binds url to it
+static ParamMask bind (const char *url, Form& form, ParamMask& errors) {
+	memset (&form, 0xEE, sizeof (form));
+	return bindQuery (url, specs, SPECS_NO, &form, errors);
+}
+
+static void testValid () {
+	Form form;
+	ParamMask errors;
+
+	CHECK (bind ("/net.html", form, errors) == 0 && errors == 0);
+	CHECK (bind ("/net.html?", form, errors) == 0 && errors == 0);
+
+	// Percent-encoding, mixed case hex digits, every type
+	CHECK (bind ("/net.html?mac=00%3A11%3A22%3Aaa%3ABB%3Aff&mode=static&ip=192.168.1.42&n=-5&flag=1", form, errors) ==
+	       (P_MAC | P_MODE | P_IP | P_N | P_FLAG));
+	CHECK (errors == 0);
+	const byte mac[6] = {0x00, 0x11, 0x22, 0xAA, 0xBB, 0xFF};
+	CHECK (memcmp (form.mac, mac, 6) == 0);
+	CHECK (form.mode == 2);
+	CHECK (form.ip[0] == 192 && form.ip[1] == 168 && form.ip[2] == 1 && form.ip[3] == 42);
+	CHECK (form.n == -5);
+
+	CHECK (bind ("/x?mode=o%6e", form, errors) == P_MODE && errors == 0);
+	CHECK (form.mode == 0);
+	CHECK (bind ("/x?n=1%32&ip=%31.2.3.4", form, errors) == (P_N | P_IP) && errors == 0);
+	CHECK (form.n == 12);
+	CHECK (form.ip[0] == 1 && form.ip[3] == 4);
+
+	// As browsers send them
+	CHECK (bind ("/x?name=a+b%21&list=1%2C3", form, errors) == (P_NAME | P_LIST) && errors == 0);
+	CHECK (strcmp (form.name, "a b!") == 0);
+	CHECK (form.list == 0x05);
+	CHECK (bind ("/x?name=abcde&list=20,+2+,2", form, errors) == (P_NAME | P_LIST) && errors == 0);
+	CHECK (strcmp (form.name, "abcde") == 0);
+	CHECK (form.list == 0x80002UL);
+
+	CHECK (bind ("/x?u=4294967295&time=08%3A30", form, errors) == (P_U | P_TIME) && errors == 0);
+	CHECK (form.u == 4294967295UL);
+	CHECK (form.time == 8 * 60 + 30);
+	CHECK (bind ("/x?u=0&time=24:00", form, errors) == (P_U | P_TIME) && errors == 0);
+	CHECK (form.u == 0 && form.time == 24 * 60);
+}
+
+static void testInvalid () {
+	Form form;
+	ParamMask errors;
+
+	// Out of range, unknown choice, too short or too long
+	CHECK (bind ("/x?mode=sta&ip=192.168.1.256&n=301", form, errors) == 0);
+	CHECK (errors == (P_MODE | P_IP | P_N));
+	CHECK (bind ("/x?ip=1.2.3&mac=1:2:3:4:5:6:7", form, errors) == 0);
+	CHECK (errors == (P_MAC | P_IP));
+	CHECK (bind ("/x?ip=1.2.3.4.&n=99999999&mode=offoffoffoff", form, errors) == 0);
+	CHECK (errors == (P_MODE | P_IP | P_N));
+	CHECK (bind ("/x?n=-&ip=...", form, errors) == 0);
+	CHECK (errors == (P_IP | P_N));
+	CHECK (bind ("/x?mac=%", form, errors) == 0 && errors == P_MAC);
+	CHECK (bind ("/x?name=abcdef&list=0", form, errors) == 0 && errors == (P_NAME | P_LIST));
+	CHECK (bind ("/x?list=1,a,3", form, errors) == 0 && errors == P_LIST);
+	CHECK (bind ("/x?list=1,,3", form, errors) == 0 && errors == P_LIST);
+	CHECK (bind ("/x?list=1,3,", form, errors) == 0 && errors == P_LIST);
+	CHECK (bind ("/x?list=21", form, errors) == 0 && errors == P_LIST);
+	CHECK (bind ("/x?list=1;3", form, errors) == 0 && errors == P_LIST);
+	CHECK (bind ("/x?u=4294967296&time=0:59", form, errors) == 0 && errors == (P_U | P_TIME));
+	CHECK (bind ("/x?u=-1&time=8:60", form, errors) == 0 && errors == (P_U | P_TIME));
+	CHECK (bind ("/x?u=1x&time=8", form, errors) == 0 && errors == (P_U | P_TIME));
+	CHECK (bind ("/x?time=8:&time=:30", form, errors) == 0 && errors == P_TIME);
+	CHECK (bind ("/x?time=008:00", form, errors) == 0 && errors == P_TIME);
+
+	// Empty ones count as missing, unknown ones are ignored
+	CHECK (bind ("/x?n=&mode=&foo=bar&&=&n", form, errors) == 0 && errors == 0);
+
+	// The last one wins
+	CHECK (bind ("/x?n=12&n=abc", form, errors) == 0 && errors == P_N);
+}
+
+static void testRandom () {
+	const char alphabet[] = "=&%3Aa1.-:+09FfmacipnodeMAC?,2Clstu";
+	const byte canary = 0x5A;
+
+	// The form sits between two guard areas
+	struct {
+		byte before[8];
+		Form form;
+		byte after[8];
+	} buf;
+	Form *form = &buf.form;
+
+	srand (1);
+	for (long k = 0; k < 200000; k++) {
+		char url[64] = "/p?";
+		int len = rand () % 60;
+		for (int i = 0; i < len; i++)
+			url[3 + i] = alphabet[rand () % (sizeof (alphabet) - 1)];
+		url[3 + len] = '\0';
+
+		memset (&buf, canary, sizeof (buf));
+		ParamMask errors;
+		ParamMask found = bindQuery (url, specs, SPECS_NO, form, errors);
+
+		boolean ok = (found & errors) == 0 && (found | errors) < PARAM_BIT (SPECS_NO);
+		for (byte i = 0; i < 8; i++)
+			ok = ok && buf.before[i] == canary && buf.after[i] == canary;
+		if (found & P_N)
+			ok = ok && form -> n >= -5 && form -> n <= 300;
+		if (found & P_MODE)
+			ok = ok && form -> mode < 3;
+		if (found & P_NAME)
+			ok = ok && strlen (form -> name) <= 5;
+		if (found & P_LIST)
+			ok = ok && form -> list != 0 && form -> list < (1UL << 20);
+		if (found & P_U)
+			ok = ok && form -> u <= 0xFFFFFFFFUL;
+		if (found & P_TIME)
+			ok = ok && form -> time >= 60 && form -> time <= 24 * 60;
+
+		if (!ok) {
+			fprintf (stderr, "Failed on %s\n", url);
+			CHECK (ok);
+			break;
+		}
+	}
+}
+
+// Same as tokenize() in the sketch, which the old code used for addresses
+static bool oldTokenize (const char *str, const char *sep, byte *buffer, size_t bufsize, int base) {
+	byte count = 0;
+	for (const char *str2 = str; (str2 = strstr (str2, sep)); ++str2)
+		++count;
+
+	if (count != bufsize - 1)
+		return false;
+
+	for (byte i = 0; i < bufsize; ++i) {
+		buffer[i] = strtol (str, NULL, base);
+		str = strstr (str, sep) + 1;
+	}
+
+	return true;
+}
+
+// What the page functions did before bindQuery(), one parameter at a time
+static ParamMask oldBind (HTTPRequestParser& request, Form& form) {
+	ParamMask found = 0;
+	char *param;
+
+	param = request.get_parameter ("mac");
+	if (strlen (param) > 0 && oldTokenize (param, "%3A", form.mac, 6, 16))
+		found |= P_MAC;
+
+	param = request.get_parameter ("mode");
+	if (strlen (param) > 0) {
+		if (strcmp (param, "on") == 0)
+			form.mode = 0;
+		else if (strcmp (param, "off") == 0)
+			form.mode = 1;
+		else
+			form.mode = 2;
+		found |= P_MODE;
+	}
+
+	param = request.get_parameter ("ip");
+	if (strlen (param) > 0 && oldTokenize (param, ".", form.ip, 4, 10))
+		found |= P_IP;
+
+	param = request.get_parameter ("n");
+	if (strlen (param) > 0) {
+		form.n = atoi (param);
+		found |= P_N;
+	}
+
+	param = request.get_parameter ("flag");
+	if (strlen (param) > 0)
+		found |= P_FLAG;
+
+	return found;
+}
+
+static double nsPerQuery (std::chrono::steady_clock::time_point start, long n) {
+	return std::chrono::duration<double, std::nano> (std::chrono::steady_clock::now () - start).count () / n;
+}
+
+static void bench (long n) {
+	const char *url = "/net.html?mac=00%3A11%3A22%3A33%3A44%3A55&mode=static&ip=192.168.1.42&n=200&flag=1";
+	HTTPRequestParser request;
+	Form form;
+	ParamMask errors;
+	volatile ParamMask sink = 0;
+
+	request.parse (url);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+	for (long i = 0; i < n; i++)
+		sink = sink + bindQuery (request.url, specs, SPECS_NO, &form, errors);
+	double bound = nsPerQuery (start, n);
+
+	start = std::chrono::steady_clock::now ();
+	for (long i = 0; i < n; i++)
+		sink = sink + oldBind (request, form);
+	double old = nsPerQuery (start, n);
+
+	printf ("%-20s %8.1f ns/query\n", "bindQuery()", bound);
+	printf ("%-20s %8.1f ns/query\n", "get_parameter()", old);
+}
+
+int main (int argc, char *argv[]) {
+	if (argc > 1 && strcmp (argv[1], "--bench") == 0) {
+		bench (argc > 2 ? atol (argv[2]) : 1000000L);
+		return 0;
+	}
+
+	testValid ();
+	testInvalid ();
+	testRandom ();
+
+	return CHECK_RESULT ();
+}
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Tests for the weekly schedule: a range that rounds down to no slot at all
+ * must be rejected rather than accepted and ignored.
+ */
+
+#include <EEPROM.h>
+#include "common.h"
+#include "Schedule.h"
+#include "check.h"
+
+// Sunday 1/1/2017, 00:00
+#define SUNDAY 1483228800UL
+
+static void testRounding () {
+	eepromClear ();
+
+	Schedule schedule;
+	schedule.begin (1, 0);
+
+	// Same slot once rounded down
+	CHECK (!schedule.set (0, 8 * 60 + 10, 8 * 60 + 20, true));
+	CHECK (!schedule.set (0, 8 * 60, 8 * 60 + 29, true));
+	CHECK (!schedule.set (0, 9 * 60, 8 * 60, true));
+	CHECK (!schedule.set (0, 0, 24 * 60 + 1, true));
+	CHECK (!schedule.set (9, 0, 60, true));
+	for (unsigned int slot = 0; slot < SCHEDULE_SLOTS; slot++)
+		CHECK (!schedule.getSlot (slot));
+
+	CHECK (schedule.set (0, 8 * 60 + 10, 8 * 60 + 30, true));
+	for (unsigned int slot = 0; slot < SCHEDULE_SLOTS; slot++)
+		CHECK (schedule.getSlot (slot) == (slot == 16));
+
+	CHECK (schedule.set (SCHEDULE_EVERY_DAY, 23 * 60 + 30, 24 * 60, true));
+	CHECK (schedule.getSlot (SCHEDULE_SLOTS - 1));
+
+	schedule.update (SUNDAY + 8 * 3600UL + 15 * 60);
+	CHECK (schedule.isActive ());
+	CHECK (schedule.getNextChange () == SUNDAY + 8 * 3600UL + 30 * 60);
+}
+
+int main () {
+	testRounding ();
+
+	return CHECK_RESULT ();
+}
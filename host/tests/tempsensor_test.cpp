@@ -0,0 +1,75 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Tests for TempSensor: a snapshot must only stay valid as long as readings
+ * keep getting through, so that relays never act on a stale temperature.
+ */
+
+#include "TempSensor.h"
+#include "check.h"
+
+// Runs the state machine for a while, returns true if a cycle completed
+static boolean cycle (TempSensor& sensor) {
+	boolean done = false;
+
+	for (byte i = 0; i < 10 && !done; i++)
+		done = sensor.loop ();
+
+	return done;
+}
+
+int main () {
+	TempSensor sensor (THERMOMETER_PIN);
+
+	oneWireSetDevices (1);
+	oneWireSetTemperature (0, 2150);
+	sensor.begin (12, 0);
+	CHECK (sensor.available);
+
+	CHECK (cycle (sensor));
+	CHECK (sensor.getSnapshot ().valid);
+	CHECK (sensor.getSnapshot ().celsius == 2150);
+
+	// CRC errors on every retry
+	oneWireSetCrcErrors (0, true);
+	cycle (sensor);
+	CHECK (!sensor.getSnapshot ().valid);
+	CHECK (sensor.rejectedReadings == 1);
+	oneWireSetCrcErrors (0, false);
+	cycle (sensor);
+	CHECK (sensor.getSnapshot ().valid);
+
+	// The power-on value, far from the last reading
+	oneWireSetTemperature (0, 8500);
+	cycle (sensor);
+	CHECK (!sensor.getSnapshot ().valid);
+	oneWireSetTemperature (0, 2200);
+	cycle (sensor);
+	CHECK (sensor.getSnapshot ().valid);
+
+	// Nobody answers the reset anymore
+	oneWireSetDevices (0);
+	cycle (sensor);
+	CHECK (!sensor.getSnapshot ().valid);
+	oneWireSetDevices (1);
+	cycle (sensor);
+	CHECK (sensor.getSnapshot ().valid);
+
+	return CHECK_RESULT ();
+}
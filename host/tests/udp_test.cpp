@@ -0,0 +1,257 @@
+/***************************************************************************
+ *   This file is part of SmartStrip.                                      *
+ *                                                                         *
+ *   Copyright (C) 2012-2016 by SukkoPera                                  *
+ *                                                                         *
+ *   SmartStrip is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   SmartStrip is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+/* Tests for the UDP control protocol, with an in-memory socket: requests must
+ * be authenticated, and SET requests can't be replayed, not even after a
+ * reboot.
+ */
+
+#include <deque>
+#include <vector>
+
+// The sketch is built without UDP by default, so build UdpControl here
+#define ENABLE_UDP
+#define UDP_KEY 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+#include "UdpControl.cpp"
+
+#include "check.h"
+
+static const byte key[SIPHASH_KEY_SIZE] = {UDP_KEY};
+
+class FakeUdp: public UDP {
+public:
+	std::deque<std::vector<byte> > in;
+	std::vector<std::vector<byte> > out;
+
+	uint8_t begin (uint16_t port) override {
+		return 1;
+	}
+
+	int parsePacket () override {
+		if (!current.empty ())
+			in.pop_front ();
+		current.clear ();
+		if (!in.empty ())
+			current = in.front ();
+		pos = 0;
+		return current.size ();
+	}
+
+	int read (unsigned char *buffer, size_t len) override {
+		len = min (len, current.size () - pos);
+		memcpy (buffer, current.data () + pos, len);
+		pos += len;
+		return len;
+	}
+
+	int read () override {
+		return pos < current.size () ? current[pos++] : -1;
+	}
+
+	int available () override {
+		return current.size () - pos;
+	}
+
+	int beginPacket (IPAddress ip, uint16_t port) override {
+		out.push_back (std::vector<byte> ());
+		return 1;
+	}
+
+	size_t write (uint8_t c) override {
+		out.back ().push_back (c);
+		return 1;
+	}
+
+	size_t write (const uint8_t *buffer, size_t size) override {
+		out.back ().insert (out.back ().end (), buffer, buffer + size);
+		return size;
+	}
+
+	int endPacket () override {
+		return 1;
+	}
+
+	IPAddress remoteIP () override {
+		return IPAddress (127, 0, 0, 1);
+	}
+
+	uint16_t remotePort () override {
+		return 12345;
+	}
+
+private:
+	std::vector<byte> current;
+	size_t pos = 0;
+};
+
+static unsigned int handled;
+
+static byte handler (UdpPacket& packet) {
+	++handled;
+	packet.stateVersion = handled;
+	return UDP_OK;
+}
+
+static std::vector<byte> request (byte command, uint32_t seq, boolean signedPacket = true) {
+	UdpPacket packet;
+
+	memset (&packet, 0, sizeof (packet));
+	packet.magic = UDP_MAGIC;
+	packet.version = UDP_PROTO_VERSION;
+	packet.command = command;
+	packet.seq = seq;
+	if (signedPacket)
+		sipHash24 (key, reinterpret_cast<const byte *> (&packet), offsetof (UdpPacket, mac), packet.mac);
+
+	const byte *p = reinterpret_cast<const byte *> (&packet);
+	return std::vector<byte> (p, p + sizeof (packet));
+}
+
+/* Sends a request and returns true if a reply with a valid MAC came back,
+ * which is then stored in reply
+ */
+static boolean exchange (UdpControl& control, FakeUdp& udp, const std::vector<byte>& req, UdpPacket& reply) {
+	udp.in.push_back (req);
+	udp.out.clear ();
+	control.loop ();
+	udp.parsePacket ();			// Drop the request, whether it was read or not
+
+	if (udp.out.size () != 1 || udp.out[0].size () != sizeof (reply))
+		return false;
+
+	byte mac[SIPHASH_SIZE];
+	memcpy (&reply, udp.out[0].data (), sizeof (reply));
+	sipHash24 (key, reinterpret_cast<const byte *> (&reply), offsetof (UdpPacket, mac), mac);
+	return memcmp (mac, reply.mac, SIPHASH_SIZE) == 0;
+}
+
+// Status of the reply to a signed request, 0xFF if there was none
+static byte send (UdpControl& control, FakeUdp& udp, byte command, uint32_t seq, uint32_t *replySeq = NULL) {
+	UdpPacket reply;
+
+	if (!exchange (control, udp, request (command, seq), reply))
+		return 0xFF;
+	if (replySeq)
+		*replySeq = reply.seq;
+	return reply.status;
+}
+
+// Reference vector from the SipHash paper: 15 bytes (0x00-0x0E), key 0x00-0x0F
+static void testSipHash () {
+	const byte expected[SIPHASH_SIZE] = {0xe5, 0x45, 0xbe, 0x49, 0x61, 0xca, 0x29, 0xa1};
+	byte data[15], out[SIPHASH_SIZE];
+
+	for (byte i = 0; i < sizeof (data); i++)
+		data[i] = i;
+	sipHash24 (key, data, sizeof (data), out);
+	CHECK (memcmp (out, expected, SIPHASH_SIZE) == 0);
+}
+
+static void testAuthentication () {
+	FakeUdp udp;
+	UdpControl control (udp);
+	UdpPacket reply;
+
+	eepromClear ();
+	control.format ();
+	control.begin (UDP_PORT, handler);
+	handled = 0;
+
+	// Unsigned, truncated and foreign packets are dropped silently
+	CHECK (!exchange (control, udp, request (UDP_CMD_GET, 1, false), reply));
+	std::vector<byte> req = request (UDP_CMD_GET, 1);
+	req.pop_back ();
+	CHECK (!exchange (control, udp, req, reply));
+	req = request (UDP_CMD_GET, 1);
+	req[0] = 'X';
+	CHECK (!exchange (control, udp, req, reply));
+	CHECK (handled == 0);
+
+	CHECK (exchange (control, udp, request (UDP_CMD_GET, 7), reply));
+	CHECK (reply.command == (UDP_CMD_GET | UDP_REPLY));
+	CHECK (reply.status == UDP_OK);
+	CHECK (reply.seq == 7);
+	CHECK (handled == 1);
+
+	CHECK (send (control, udp, 9, 8) == UDP_BAD_REQUEST);
+	CHECK (handled == 1);
+}
+
+static void testReplay () {
+	FakeUdp udp;
+	uint32_t seq;
+
+	eepromClear ();
+	{
+		UdpControl control (udp);
+		control.format ();
+		control.begin (UDP_PORT, handler);
+		handled = 0;
+
+		CHECK (send (control, udp, UDP_CMD_SET, 5) == UDP_OK);
+		CHECK (send (control, udp, UDP_CMD_SET, 5, &seq) == UDP_OLD_SEQ);
+		CHECK (seq == 5);
+		CHECK (send (control, udp, UDP_CMD_SET, 4) == UDP_OLD_SEQ);
+		CHECK (send (control, udp, UDP_CMD_SET, 6) == UDP_OK);
+		CHECK (handled == 2);
+
+		// GETs don't change anything, so they are never too old
+		CHECK (send (control, udp, UDP_CMD_GET, 1) == UDP_OK);
+	}
+
+	// After a reboot, the same requests must still be refused
+	{
+		UdpControl control (udp);
+		control.begin (UDP_PORT, handler);
+		handled = 0;
+
+		CHECK (send (control, udp, UDP_CMD_SET, 6, &seq) == UDP_OLD_SEQ);
+		CHECK (seq >= 6);
+		CHECK (send (control, udp, UDP_CMD_SET, 5) == UDP_OLD_SEQ);
+		CHECK (handled == 0);
+
+		// Clients carry on from what the board tells them
+		CHECK (send (control, udp, UDP_CMD_SET, seq + 1) == UDP_OK);
+		CHECK (handled == 1);
+	}
+}
+
+// The sequence number must not be written to EEPROM on every request
+static void testWear () {
+	FakeUdp udp;
+	UdpControl control (udp);
+
+	eepromClear ();
+	control.format ();
+	control.begin (UDP_PORT, handler);
+
+	unsigned long writes = EEPROM.writes;
+	for (uint32_t seq = 1; seq <= 10 * UDP_SEQ_RESERVE; seq++)
+		send (control, udp, UDP_CMD_SET, seq);
+	CHECK (EEPROM.writes - writes <= 10 * (EEPROM_UDP_SEQ_SIZE + 1));
+}
+
+int main () {
+	testSipHash ();
+	testAuthentication ();
+	testReplay ();
+	testWear ();
+
+	return CHECK_RESULT ();
+}
@@ -1,3 +1,5 @@
+// Generated by tools/html2h.py from the pages in html/, do not edit by hand!
+
 const char about_html_name[] PROGMEM = "/about.html";
 
 const char about_html[] PROGMEM = {
@@ -62,6 +64,248 @@ const char about_html[] PROGMEM = {
 
 // unsigned int about_html_len = 456;
 
+const char api_relays_name[] PROGMEM = "/api/relays";
+
+const char api_relays[] PROGMEM = {
+	0x7b,  0x22,  0x63,  0x68,  0x61,  0x6e,  0x67,  0x65,  
+	0x64,  0x22,  0x3a,  0x23,  0x41,  0x50,  0x49,  0x5f,  
+	0x43,  0x48,  0x41,  0x4e,  0x47,  0x45,  0x44,  0x23,  
+	0x2c,  0x22,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x73,  
+	0x22,  0x3a,  0x23,  0x41,  0x50,  0x49,  0x5f,  0x45,  
+	0x52,  0x52,  0x4f,  0x52,  0x53,  0x23,  0x2c,  0x22,  
+	0x72,  0x65,  0x6c,  0x61,  0x79,  0x73,  0x22,  0x3a,  
+	0x5b,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x7b,  0x22,  0x69,  
+	0x64,  0x22,  0x3a,  0x31,  0x2c,  0x22,  0x6d,  0x6f,  
+	0x64,  0x65,  0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x4d,  0x4f,  0x44,  
+	0x45,  0x23,  0x22,  0x2c,  0x22,  0x73,  0x74,  0x61,  
+	0x74,  0x65,  0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  0x54,  0x23,  
+	0x22,  0x7d,  0x2c,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x7b,  
+	0x22,  0x69,  0x64,  0x22,  0x3a,  0x32,  0x2c,  0x22,  
+	0x6d,  0x6f,  0x64,  0x65,  0x22,  0x3a,  0x22,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x4d,  
+	0x4f,  0x44,  0x45,  0x23,  0x22,  0x2c,  0x22,  0x73,  
+	0x74,  0x61,  0x74,  0x65,  0x22,  0x3a,  0x22,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  
+	0x54,  0x23,  0x22,  0x7d,  0x2c,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  0x58,  0x54,  
+	0x23,  0x7b,  0x22,  0x69,  0x64,  0x22,  0x3a,  0x33,  
+	0x2c,  0x22,  0x6d,  0x6f,  0x64,  0x65,  0x22,  0x3a,  
+	0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  
+	0x5f,  0x4d,  0x4f,  0x44,  0x45,  0x23,  0x22,  0x2c,  
+	0x22,  0x73,  0x74,  0x61,  0x74,  0x65,  0x22,  0x3a,  
+	0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  
+	0x5f,  0x53,  0x54,  0x23,  0x22,  0x7d,  0x2c,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x7b,  0x22,  0x69,  0x64,  0x22,  
+	0x3a,  0x34,  0x2c,  0x22,  0x6d,  0x6f,  0x64,  0x65,  
+	0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x4e,  0x5f,  0x4d,  0x4f,  0x44,  0x45,  0x23,  
+	0x22,  0x2c,  0x22,  0x73,  0x74,  0x61,  0x74,  0x65,  
+	0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x4e,  0x5f,  0x53,  0x54,  0x23,  0x22,  0x7d,  
+	0x5d,  0x7d,  0x00
+};
+
+// unsigned int api_relays_len = 323;
+
+const char api_state_name[] PROGMEM = "/api/state";
+
+const char api_state[] PROGMEM = {
+	0x7b,  0x22,  0x76,  0x65,  0x72,  0x73,  0x69,  0x6f,  
+	0x6e,  0x22,  0x3a,  0x22,  0x23,  0x56,  0x45,  0x52,  
+	0x53,  0x49,  0x4f,  0x4e,  0x23,  0x22,  0x2c,  0x22,  
+	0x73,  0x74,  0x61,  0x74,  0x65,  0x76,  0x65,  0x72,  
+	0x22,  0x3a,  0x23,  0x53,  0x54,  0x41,  0x54,  0x45,  
+	0x5f,  0x56,  0x45,  0x52,  0x23,  0x2c,  0x22,  0x75,  
+	0x70,  0x74,  0x69,  0x6d,  0x65,  0x22,  0x3a,  0x23,  
+	0x55,  0x50,  0x54,  0x49,  0x4d,  0x45,  0x5f,  0x53,  
+	0x23,  0x2c,  0x22,  0x74,  0x65,  0x6d,  0x70,  0x22,  
+	0x3a,  0x23,  0x44,  0x45,  0x47,  0x43,  0x5f,  0x4a,  
+	0x53,  0x4f,  0x4e,  0x23,  0x2c,  0x22,  0x72,  0x65,  
+	0x6c,  0x61,  0x79,  0x73,  0x22,  0x3a,  0x5b,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x7b,  0x22,  0x69,  0x64,  0x22,  
+	0x3a,  0x31,  0x2c,  0x22,  0x6d,  0x6f,  0x64,  0x65,  
+	0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x4e,  0x5f,  0x4d,  0x4f,  0x44,  0x45,  0x23,  
+	0x22,  0x2c,  0x22,  0x73,  0x74,  0x61,  0x74,  0x65,  
+	0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x4e,  0x5f,  0x53,  0x54,  0x23,  0x22,  0x2c,  
+	0x22,  0x74,  0x68,  0x72,  0x65,  0x73,  0x22,  0x3a,  
+	0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  
+	0x54,  0x48,  0x52,  0x45,  0x53,  0x23,  0x2c,  0x22,  
+	0x75,  0x6e,  0x69,  0x74,  0x73,  0x22,  0x3a,  0x22,  
+	0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  
+	0x55,  0x4e,  0x49,  0x54,  0x53,  0x23,  0x22,  0x7d,  
+	0x2c,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x7b,  0x22,  0x69,  
+	0x64,  0x22,  0x3a,  0x32,  0x2c,  0x22,  0x6d,  0x6f,  
+	0x64,  0x65,  0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x4d,  0x4f,  0x44,  
+	0x45,  0x23,  0x22,  0x2c,  0x22,  0x73,  0x74,  0x61,  
+	0x74,  0x65,  0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  0x54,  0x23,  
+	0x22,  0x2c,  0x22,  0x74,  0x68,  0x72,  0x65,  0x73,  
+	0x22,  0x3a,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x4e,  0x5f,  0x54,  0x48,  0x52,  0x45,  0x53,  0x23,  
+	0x2c,  0x22,  0x75,  0x6e,  0x69,  0x74,  0x73,  0x22,  
+	0x3a,  0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x4e,  0x5f,  0x55,  0x4e,  0x49,  0x54,  0x53,  0x23,  
+	0x22,  0x7d,  0x2c,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x7b,  
+	0x22,  0x69,  0x64,  0x22,  0x3a,  0x33,  0x2c,  0x22,  
+	0x6d,  0x6f,  0x64,  0x65,  0x22,  0x3a,  0x22,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x4d,  
+	0x4f,  0x44,  0x45,  0x23,  0x22,  0x2c,  0x22,  0x73,  
+	0x74,  0x61,  0x74,  0x65,  0x22,  0x3a,  0x22,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  
+	0x54,  0x23,  0x22,  0x2c,  0x22,  0x74,  0x68,  0x72,  
+	0x65,  0x73,  0x22,  0x3a,  0x23,  0x52,  0x45,  0x4c,  
+	0x41,  0x59,  0x4e,  0x5f,  0x54,  0x48,  0x52,  0x45,  
+	0x53,  0x23,  0x2c,  0x22,  0x75,  0x6e,  0x69,  0x74,  
+	0x73,  0x22,  0x3a,  0x22,  0x23,  0x52,  0x45,  0x4c,  
+	0x41,  0x59,  0x4e,  0x5f,  0x55,  0x4e,  0x49,  0x54,  
+	0x53,  0x23,  0x22,  0x7d,  0x2c,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  0x58,  0x54,  
+	0x23,  0x7b,  0x22,  0x69,  0x64,  0x22,  0x3a,  0x34,  
+	0x2c,  0x22,  0x6d,  0x6f,  0x64,  0x65,  0x22,  0x3a,  
+	0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  
+	0x5f,  0x4d,  0x4f,  0x44,  0x45,  0x23,  0x22,  0x2c,  
+	0x22,  0x73,  0x74,  0x61,  0x74,  0x65,  0x22,  0x3a,  
+	0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  
+	0x5f,  0x53,  0x54,  0x23,  0x22,  0x2c,  0x22,  0x74,  
+	0x68,  0x72,  0x65,  0x73,  0x22,  0x3a,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x54,  0x48,  
+	0x52,  0x45,  0x53,  0x23,  0x2c,  0x22,  0x75,  0x6e,  
+	0x69,  0x74,  0x73,  0x22,  0x3a,  0x22,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x55,  0x4e,  
+	0x49,  0x54,  0x53,  0x23,  0x22,  0x7d,  0x5d,  0x7d,  
+	0x00
+};
+
+// unsigned int api_state_len = 553;
+
+const char api_time_name[] PROGMEM = "/api/time";
+
+const char api_time[] PROGMEM = {
+	0x7b,  0x22,  0x74,  0x69,  0x6d,  0x65,  0x22,  0x3a,  
+	0x23,  0x54,  0x49,  0x4d,  0x45,  0x5f,  0x53,  0x23,  
+	0x7d,  0x00
+};
+
+// unsigned int api_time_len = 18;
+
+const char api_version_name[] PROGMEM = "/api/version";
+
+const char api_version[] PROGMEM = {
+	0x23,  0x53,  0x54,  0x41,  0x54,  0x45,  0x5f,  0x56,  
+	0x45,  0x52,  0x23,  0x00
+};
+
+// unsigned int api_version_len = 12;
+
+const char events_name[] PROGMEM = "/events";
+
+const char events[] PROGMEM = {
+	0x7b,  0x22,  0x73,  0x74,  0x61,  0x74,  0x65,  0x76,  
+	0x65,  0x72,  0x22,  0x3a,  0x23,  0x53,  0x54,  0x41,  
+	0x54,  0x45,  0x5f,  0x56,  0x45,  0x52,  0x23,  0x2c,  
+	0x22,  0x72,  0x65,  0x6c,  0x61,  0x79,  0x73,  0x22,  
+	0x3a,  0x7b,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x45,  0x56,  
+	0x49,  0x44,  0x23,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x4e,  0x5f,  0x45,  0x56,  0x23,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x4e,  0x5f,  0x45,  0x56,  0x49,  0x44,  0x23,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x45,  
+	0x56,  0x23,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x45,  0x56,  
+	0x49,  0x44,  0x23,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x4e,  0x5f,  0x45,  0x56,  0x23,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x4e,  0x5f,  0x45,  0x56,  0x49,  0x44,  0x23,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x45,  
+	0x56,  0x23,  0x7d,  0x23,  0x54,  0x45,  0x4d,  0x50,  
+	0x5f,  0x45,  0x56,  0x23,  0x7d,  0x00
+};
+
+// unsigned int events_len = 190;
+
+const char history_csv_name[] PROGMEM = "/history.csv";
+
+const char history_csv[] PROGMEM = {
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  
+	0x23,  0x48,  0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  
+	0x49,  0x53,  0x54,  0x23,  0x23,  0x48,  0x49,  0x53,  
+	0x54,  0x23,  0x00
+};
+
+// unsigned int history_csv_len = 475;
+
 const char index_html_name[] PROGMEM = "/index.html";
 
 const char index_html[] PROGMEM = {
@@ -91,24 +335,24 @@ const char index_html[] PROGMEM = {
 	0x61,  0x6d,  0x65,  0x20,  0x73,  0x72,  0x63,  0x3d,  
 	0x22,  0x6c,  0x65,  0x66,  0x74,  0x2e,  0x68,  0x74,  
 	0x6d,  0x6c,  0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  
-	0x3d,  0x22,  0x6c,  0x65,  0x66,  0x74,  0x22,  0x20,  
-	0x2f,  0x3e,  0x3c,  0x66,  0x72,  0x61,  0x6d,  0x65,  
-	0x20,  0x73,  0x72,  0x63,  0x3d,  0x22,  0x6d,  0x61,  
-	0x69,  0x6e,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x22,  
-	0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x72,  
-	0x69,  0x67,  0x68,  0x74,  0x22,  0x20,  0x2f,  0x3e,  
-	0x3c,  0x6e,  0x6f,  0x66,  0x72,  0x61,  0x6d,  0x65,  
-	0x73,  0x3e,  0x3c,  0x70,  0x3e,  0x53,  0x6f,  0x72,  
-	0x72,  0x79,  0x2c,  0x20,  0x66,  0x72,  0x61,  0x6d,  
-	0x65,  0x73,  0x20,  0x6e,  0x65,  0x65,  0x64,  0x65,  
-	0x64,  0x2e,  0x3c,  0x2f,  0x70,  0x3e,  0x3c,  0x2f,  
-	0x6e,  0x6f,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x73,  
-	0x3e,  0x3c,  0x2f,  0x66,  0x72,  0x61,  0x6d,  0x65,  
-	0x73,  0x65,  0x74,  0x3e,  0x3c,  0x2f,  0x68,  0x74,  
-	0x6d,  0x6c,  0x3e,  0x00
+	0x3d,  0x22,  0x6c,  0x65,  0x66,  0x74,  0x22,  0x2f,  
+	0x3e,  0x3c,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x20,  
+	0x73,  0x72,  0x63,  0x3d,  0x22,  0x6d,  0x61,  0x69,  
+	0x6e,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x22,  0x20,  
+	0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x72,  0x69,  
+	0x67,  0x68,  0x74,  0x22,  0x2f,  0x3e,  0x3c,  0x6e,  
+	0x6f,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x73,  0x3e,  
+	0x3c,  0x70,  0x3e,  0x53,  0x6f,  0x72,  0x72,  0x79,  
+	0x2c,  0x20,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x73,  
+	0x20,  0x6e,  0x65,  0x65,  0x64,  0x65,  0x64,  0x2e,  
+	0x3c,  0x2f,  0x70,  0x3e,  0x3c,  0x2f,  0x6e,  0x6f,  
+	0x66,  0x72,  0x61,  0x6d,  0x65,  0x73,  0x3e,  0x3c,  
+	0x2f,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x73,  0x65,  
+	0x74,  0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  
+	0x3e,  0x00
 };
 
-// unsigned int index_html_len = 324;
+// unsigned int index_html_len = 322;
 
 const char left_html_name[] PROGMEM = "/left.html";
 
@@ -159,29 +403,36 @@ const char left_html[] PROGMEM = {
 	0x20,  0x34,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  
 	0x6c,  0x69,  0x3e,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  
 	0x3c,  0x6c,  0x69,  0x3e,  0x3c,  0x61,  0x20,  0x68,  
-	0x72,  0x65,  0x66,  0x3d,  0x22,  0x6e,  0x65,  0x74,  
-	0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x22,  0x3e,  0x4e,  
-	0x65,  0x74,  0x77,  0x6f,  0x72,  0x6b,  0x20,  0x43,  
-	0x6f,  0x6e,  0x66,  0x69,  0x67,  0x75,  0x72,  0x61,  
-	0x74,  0x69,  0x6f,  0x6e,  0x3c,  0x2f,  0x61,  0x3e,  
-	0x3c,  0x2f,  0x6c,  0x69,  0x3e,  0x3c,  0x62,  0x72,  
-	0x2f,  0x3e,  0x3c,  0x6c,  0x69,  0x3e,  0x3c,  0x61,  
-	0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  0x6f,  
-	0x70,  0x74,  0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  
-	0x22,  0x3e,  0x4f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
-	0x73,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  0x6c,  
-	0x69,  0x3e,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  0x3c,  
-	0x6c,  0x69,  0x3e,  0x3c,  0x61,  0x20,  0x68,  0x72,  
-	0x65,  0x66,  0x3d,  0x22,  0x61,  0x62,  0x6f,  0x75,  
+	0x72,  0x65,  0x66,  0x3d,  0x22,  0x73,  0x63,  0x65,  
+	0x6e,  0x65,  0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  
+	0x22,  0x3e,  0x53,  0x63,  0x65,  0x6e,  0x65,  0x73,  
+	0x20,  0x61,  0x6e,  0x64,  0x20,  0x47,  0x72,  0x6f,  
+	0x75,  0x70,  0x73,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  
+	0x2f,  0x6c,  0x69,  0x3e,  0x3c,  0x62,  0x72,  0x2f,  
+	0x3e,  0x3c,  0x6c,  0x69,  0x3e,  0x3c,  0x61,  0x20,  
+	0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  0x6e,  0x65,  
 	0x74,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x22,  0x3e,  
-	0x41,  0x62,  0x6f,  0x75,  0x74,  0x3c,  0x2f,  0x61,  
-	0x3e,  0x3c,  0x2f,  0x6c,  0x69,  0x3e,  0x3c,  0x2f,  
-	0x75,  0x6c,  0x3e,  0x3c,  0x2f,  0x62,  0x6f,  0x64,  
-	0x79,  0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  
-	0x3e,  0x00
+	0x4e,  0x65,  0x74,  0x77,  0x6f,  0x72,  0x6b,  0x20,  
+	0x43,  0x6f,  0x6e,  0x66,  0x69,  0x67,  0x75,  0x72,  
+	0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3c,  0x2f,  0x61,  
+	0x3e,  0x3c,  0x2f,  0x6c,  0x69,  0x3e,  0x3c,  0x62,  
+	0x72,  0x2f,  0x3e,  0x3c,  0x6c,  0x69,  0x3e,  0x3c,  
+	0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  
+	0x6f,  0x70,  0x74,  0x73,  0x2e,  0x68,  0x74,  0x6d,  
+	0x6c,  0x22,  0x3e,  0x4f,  0x70,  0x74,  0x69,  0x6f,  
+	0x6e,  0x73,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  
+	0x6c,  0x69,  0x3e,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  
+	0x3c,  0x6c,  0x69,  0x3e,  0x3c,  0x61,  0x20,  0x68,  
+	0x72,  0x65,  0x66,  0x3d,  0x22,  0x61,  0x62,  0x6f,  
+	0x75,  0x74,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x22,  
+	0x3e,  0x41,  0x62,  0x6f,  0x75,  0x74,  0x3c,  0x2f,  
+	0x61,  0x3e,  0x3c,  0x2f,  0x6c,  0x69,  0x3e,  0x3c,  
+	0x2f,  0x75,  0x6c,  0x3e,  0x3c,  0x2f,  0x62,  0x6f,  
+	0x64,  0x79,  0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  
+	0x6c,  0x3e,  0x00
 };
 
-// unsigned int left_html_len = 522;
+// unsigned int left_html_len = 579;
 
 const char main_html_name[] PROGMEM = "/main.html";
 
@@ -192,20 +443,26 @@ const char main_html[] PROGMEM = {
 	0x69,  0x70,  0x20,  0x23,  0x56,  0x45,  0x52,  0x53,  
 	0x49,  0x4f,  0x4e,  0x23,  0x3c,  0x2f,  0x68,  0x32,  
 	0x3e,  0x3c,  0x68,  0x72,  0x3e,  0x3c,  0x68,  0x34,  
-	0x3e,  0x53,  0x6f,  0x63,  0x6b,  0x65,  0x74,  0x20,  
-	0x31,  0x3a,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  
-	0x59,  0x31,  0x5f,  0x53,  0x54,  0x23,  0x3c,  0x2f,  
-	0x68,  0x34,  0x3e,  0x3c,  0x68,  0x34,  0x3e,  0x53,  
+	0x3e,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x53,  0x6f,  0x63,  
+	0x6b,  0x65,  0x74,  0x20,  0x31,  0x3a,  0x20,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  
+	0x54,  0x23,  0x3c,  0x2f,  0x68,  0x34,  0x3e,  0x3c,  
+	0x68,  0x34,  0x3e,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x53,  
 	0x6f,  0x63,  0x6b,  0x65,  0x74,  0x20,  0x32,  0x3a,  
-	0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x32,  
+	0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  
 	0x5f,  0x53,  0x54,  0x23,  0x3c,  0x2f,  0x68,  0x34,  
-	0x3e,  0x3c,  0x68,  0x34,  0x3e,  0x53,  0x6f,  0x63,  
-	0x6b,  0x65,  0x74,  0x20,  0x33,  0x3a,  0x20,  0x23,  
-	0x52,  0x45,  0x4c,  0x41,  0x59,  0x33,  0x5f,  0x53,  
-	0x54,  0x23,  0x3c,  0x2f,  0x68,  0x34,  0x3e,  0x3c,  
-	0x68,  0x34,  0x3e,  0x53,  0x6f,  0x63,  0x6b,  0x65,  
+	0x3e,  0x3c,  0x68,  0x34,  0x3e,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  0x58,  0x54,  
+	0x23,  0x53,  0x6f,  0x63,  0x6b,  0x65,  0x74,  0x20,  
+	0x33,  0x3a,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x4e,  0x5f,  0x53,  0x54,  0x23,  0x3c,  0x2f,  
+	0x68,  0x34,  0x3e,  0x3c,  0x68,  0x34,  0x3e,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x53,  0x6f,  0x63,  0x6b,  0x65,  
 	0x74,  0x20,  0x34,  0x3a,  0x20,  0x23,  0x52,  0x45,  
-	0x4c,  0x41,  0x59,  0x34,  0x5f,  0x53,  0x54,  0x23,  
+	0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  0x54,  0x23,  
 	0x3c,  0x2f,  0x68,  0x34,  0x3e,  0x3c,  0x68,  0x72,  
 	0x3e,  0x3c,  0x68,  0x35,  0x3e,  0x46,  0x72,  0x65,  
 	0x65,  0x20,  0x52,  0x41,  0x4d,  0x3a,  0x20,  0x23,  
@@ -222,160 +479,1458 @@ const char main_html[] PROGMEM = {
 	0x43,  0x23,  0x20,  0x26,  0x64,  0x65,  0x67,  0x3b,  
 	0x43,  0x20,  0x28,  0x23,  0x44,  0x45,  0x47,  0x46,  
 	0x23,  0x20,  0x26,  0x64,  0x65,  0x67,  0x3b,  0x46,  
-	0x29,  0x3c,  0x2f,  0x68,  0x35,  0x3e,  0x3c,  0x2f,  
-	0x62,  0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x2f,  0x68,  
-	0x74,  0x6d,  0x6c,  0x3e,  0x00
+	0x29,  0x3c,  0x2f,  0x68,  0x35,  0x3e,  0x3c,  0x68,  
+	0x72,  0x3e,  0x3c,  0x68,  0x35,  0x3e,  0x23,  0x53,  
+	0x45,  0x4e,  0x53,  0x4f,  0x52,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x53,  0x65,  0x6e,  0x73,  0x6f,  
+	0x72,  0x20,  0x31,  0x3a,  0x20,  0x23,  0x53,  0x45,  
+	0x4e,  0x53,  0x4f,  0x52,  0x4e,  0x5f,  0x54,  0x45,  
+	0x4d,  0x50,  0x23,  0x20,  0x26,  0x64,  0x65,  0x67,  
+	0x3b,  0x43,  0x20,  0x28,  0x23,  0x53,  0x45,  0x4e,  
+	0x53,  0x4f,  0x52,  0x4e,  0x5f,  0x49,  0x44,  0x23,  
+	0x29,  0x3c,  0x2f,  0x68,  0x35,  0x3e,  0x3c,  0x68,  
+	0x35,  0x3e,  0x23,  0x53,  0x45,  0x4e,  0x53,  0x4f,  
+	0x52,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x53,  
+	0x65,  0x6e,  0x73,  0x6f,  0x72,  0x20,  0x32,  0x3a,  
+	0x20,  0x23,  0x53,  0x45,  0x4e,  0x53,  0x4f,  0x52,  
+	0x4e,  0x5f,  0x54,  0x45,  0x4d,  0x50,  0x23,  0x20,  
+	0x26,  0x64,  0x65,  0x67,  0x3b,  0x43,  0x20,  0x28,  
+	0x23,  0x53,  0x45,  0x4e,  0x53,  0x4f,  0x52,  0x4e,  
+	0x5f,  0x49,  0x44,  0x23,  0x29,  0x3c,  0x2f,  0x68,  
+	0x35,  0x3e,  0x3c,  0x68,  0x35,  0x3e,  0x23,  0x53,  
+	0x45,  0x4e,  0x53,  0x4f,  0x52,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x53,  0x65,  0x6e,  0x73,  0x6f,  
+	0x72,  0x20,  0x33,  0x3a,  0x20,  0x23,  0x53,  0x45,  
+	0x4e,  0x53,  0x4f,  0x52,  0x4e,  0x5f,  0x54,  0x45,  
+	0x4d,  0x50,  0x23,  0x20,  0x26,  0x64,  0x65,  0x67,  
+	0x3b,  0x43,  0x20,  0x28,  0x23,  0x53,  0x45,  0x4e,  
+	0x53,  0x4f,  0x52,  0x4e,  0x5f,  0x49,  0x44,  0x23,  
+	0x29,  0x3c,  0x2f,  0x68,  0x35,  0x3e,  0x3c,  0x68,  
+	0x35,  0x3e,  0x23,  0x53,  0x45,  0x4e,  0x53,  0x4f,  
+	0x52,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x53,  
+	0x65,  0x6e,  0x73,  0x6f,  0x72,  0x20,  0x34,  0x3a,  
+	0x20,  0x23,  0x53,  0x45,  0x4e,  0x53,  0x4f,  0x52,  
+	0x4e,  0x5f,  0x54,  0x45,  0x4d,  0x50,  0x23,  0x20,  
+	0x26,  0x64,  0x65,  0x67,  0x3b,  0x43,  0x20,  0x28,  
+	0x23,  0x53,  0x45,  0x4e,  0x53,  0x4f,  0x52,  0x4e,  
+	0x5f,  0x49,  0x44,  0x23,  0x29,  0x3c,  0x2f,  0x68,  
+	0x35,  0x3e,  0x3c,  0x2f,  0x62,  0x6f,  0x64,  0x79,  
+	0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  
+	0x00
 };
 
-// unsigned int main_html_len = 309;
+// unsigned int main_html_len = 633;
+
+const char metrics_name[] PROGMEM = "/metrics";
+
+const char metrics[] PROGMEM = {
+	0x23,  0x48,  0x41,  0x53,  0x48,  0x23,  0x20,  0x54,  
+	0x59,  0x50,  0x45,  0x20,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x75,  
+	0x70,  0x74,  0x69,  0x6d,  0x65,  0x5f,  0x73,  0x65,  
+	0x63,  0x6f,  0x6e,  0x64,  0x73,  0x20,  0x63,  0x6f,  
+	0x75,  0x6e,  0x74,  0x65,  0x72,  0x0a,  0x73,  0x6d,  
+	0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  
+	0x5f,  0x75,  0x70,  0x74,  0x69,  0x6d,  0x65,  0x5f,  
+	0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x20,  
+	0x23,  0x55,  0x50,  0x54,  0x49,  0x4d,  0x45,  0x5f,  
+	0x53,  0x23,  0x0a,  0x23,  0x48,  0x41,  0x53,  0x48,  
+	0x23,  0x20,  0x54,  0x59,  0x50,  0x45,  0x20,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  
+	0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x20,  0x68,  
+	0x69,  0x73,  0x74,  0x6f,  0x67,  0x72,  0x61,  0x6d,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x6c,  0x6f,  0x6f,  0x70,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x62,  0x75,  0x63,  
+	0x6b,  0x65,  0x74,  0x7b,  0x6c,  0x65,  0x3d,  0x22,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x4c,  
+	0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x43,  0x4e,  0x54,  0x23,  
+	0x0a,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  
+	0x72,  0x69,  0x70,  0x5f,  0x6c,  0x6f,  0x6f,  0x70,  
+	0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  
+	0x5f,  0x62,  0x75,  0x63,  0x6b,  0x65,  0x74,  0x7b,  
+	0x6c,  0x65,  0x3d,  0x22,  0x2b,  0x49,  0x6e,  0x66,  
+	0x22,  0x7d,  0x20,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  
+	0x48,  0x5f,  0x54,  0x4f,  0x54,  0x41,  0x4c,  0x23,  
+	0x0a,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  
+	0x72,  0x69,  0x70,  0x5f,  0x6c,  0x6f,  0x6f,  0x70,  
+	0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  
+	0x5f,  0x73,  0x75,  0x6d,  0x20,  0x23,  0x4c,  0x4f,  
+	0x4f,  0x50,  0x48,  0x5f,  0x53,  0x55,  0x4d,  0x23,  
+	0x0a,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  
+	0x72,  0x69,  0x70,  0x5f,  0x6c,  0x6f,  0x6f,  0x70,  
+	0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  
+	0x5f,  0x63,  0x6f,  0x75,  0x6e,  0x74,  0x20,  0x23,  
+	0x4c,  0x4f,  0x4f,  0x50,  0x48,  0x5f,  0x54,  0x4f,  
+	0x54,  0x41,  0x4c,  0x23,  0x0a,  0x23,  0x48,  0x41,  
+	0x53,  0x48,  0x23,  0x20,  0x54,  0x59,  0x50,  0x45,  
+	0x20,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  
+	0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  
+	0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  
+	0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x20,  
+	0x63,  0x6f,  0x75,  0x6e,  0x74,  0x65,  0x72,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  
+	0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x73,  0x5f,  
+	0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x52,  0x45,  0x51,  0x53,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x72,  0x65,  0x71,  0x75,  0x65,  
+	0x73,  0x74,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x52,  0x45,  
+	0x51,  0x53,  0x23,  0x0a,  0x23,  0x48,  0x41,  0x53,  
+	0x48,  0x23,  0x20,  0x54,  0x59,  0x50,  0x45,  0x20,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  
+	0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  
+	0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x20,  0x63,  0x6f,  0x75,  
+	0x6e,  0x74,  0x65,  0x72,  0x0a,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  
+	0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  
+	0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  
+	0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  
+	0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  
+	0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  
+	0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  
+	0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  
+	0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  
+	0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  
+	0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  
+	0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  
+	0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  
+	0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  
+	0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  
+	0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  
+	0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  
+	0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  
+	0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  
+	0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  
+	0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  
+	0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  
+	0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  
+	0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  
+	0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  
+	0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  
+	0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  
+	0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  
+	0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  
+	0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  
+	0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  
+	0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  
+	0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  
+	0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  
+	0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  
+	0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  
+	0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  
+	0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  
+	0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  
+	0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  
+	0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  
+	0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  
+	0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  
+	0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  
+	0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  
+	0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  
+	0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  
+	0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  
+	0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  
+	0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  
+	0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  
+	0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  
+	0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  
+	0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  
+	0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  
+	0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  
+	0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  
+	0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  
+	0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  
+	0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  
+	0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  
+	0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  
+	0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  
+	0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  
+	0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  
+	0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  
+	0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  
+	0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  
+	0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  
+	0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  
+	0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  
+	0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  
+	0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  
+	0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  
+	0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  
+	0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  
+	0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  
+	0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  
+	0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  
+	0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  
+	0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  
+	0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  
+	0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  
+	0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  
+	0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  
+	0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  
+	0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  
+	0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  
+	0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  
+	0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  
+	0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  
+	0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  
+	0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  
+	0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  
+	0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  
+	0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  0x6e,  0x64,  
+	0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  
+	0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  
+	0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  
+	0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  0x50,  
+	0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  0x49,  0x4d,  
+	0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  
+	0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  
+	0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x72,  0x65,  
+	0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  0x65,  0x63,  
+	0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  0x6f,  0x74,  
+	0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  
+	0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  
+	0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x54,  
+	0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  
+	0x47,  0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  
+	0x72,  0x65,  0x6e,  0x64,  0x65,  0x72,  0x5f,  0x73,  
+	0x65,  0x63,  0x6f,  0x6e,  0x64,  0x73,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x70,  0x61,  0x67,  
+	0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  0x22,  
+	0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  
+	0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  0x0a,  0x23,  
+	0x48,  0x41,  0x53,  0x48,  0x23,  0x20,  0x54,  0x59,  
+	0x50,  0x45,  0x20,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x20,  0x67,  0x61,  0x75,  0x67,  0x65,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x70,  0x61,  0x67,  0x65,  0x5f,  0x74,  
+	0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x5f,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x7b,  0x70,  0x61,  
+	0x67,  0x65,  0x3d,  0x22,  0x23,  0x50,  0x41,  0x47,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x22,  0x7d,  0x20,  0x23,  0x50,  0x41,  0x47,  0x45,  
+	0x4e,  0x5f,  0x53,  0x49,  0x5a,  0x45,  0x23,  0x0a,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x70,  0x61,  
+	0x67,  0x65,  0x5f,  0x74,  0x65,  0x6d,  0x70,  0x6c,  
+	0x61,  0x74,  0x65,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x7b,  0x70,  0x61,  0x67,  0x65,  0x3d,  0x22,  
+	0x23,  0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x22,  0x7d,  0x20,  0x23,  
+	0x50,  0x41,  0x47,  0x45,  0x4e,  0x5f,  0x53,  0x49,  
+	0x5a,  0x45,  0x23,  0x0a,  0x23,  0x48,  0x41,  0x53,  
+	0x48,  0x23,  0x20,  0x54,  0x59,  0x50,  0x45,  0x20,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x72,  0x65,  0x6c,  0x61,  0x79,  
+	0x5f,  0x73,  0x77,  0x69,  0x74,  0x63,  0x68,  0x65,  
+	0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x20,  
+	0x63,  0x6f,  0x75,  0x6e,  0x74,  0x65,  0x72,  0x0a,  
+	0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  0x4e,  
+	0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x72,  
+	0x65,  0x6c,  0x61,  0x79,  0x5f,  0x73,  0x77,  0x69,  
+	0x74,  0x63,  0x68,  0x65,  0x73,  0x5f,  0x74,  0x6f,  
+	0x74,  0x61,  0x6c,  0x7b,  0x72,  0x65,  0x6c,  0x61,  
+	0x79,  0x3d,  0x22,  0x31,  0x22,  0x7d,  0x20,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  
+	0x57,  0x23,  0x0a,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x72,  0x65,  0x6c,  0x61,  0x79,  0x5f,  
+	0x73,  0x77,  0x69,  0x74,  0x63,  0x68,  0x65,  0x73,  
+	0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x72,  
+	0x65,  0x6c,  0x61,  0x79,  0x3d,  0x22,  0x32,  0x22,  
+	0x7d,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x4e,  0x5f,  0x53,  0x57,  0x23,  0x0a,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  
+	0x74,  0x72,  0x69,  0x70,  0x5f,  0x72,  0x65,  0x6c,  
+	0x61,  0x79,  0x5f,  0x73,  0x77,  0x69,  0x74,  0x63,  
+	0x68,  0x65,  0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x7b,  0x72,  0x65,  0x6c,  0x61,  0x79,  0x3d,  
+	0x22,  0x33,  0x22,  0x7d,  0x20,  0x23,  0x52,  0x45,  
+	0x4c,  0x41,  0x59,  0x4e,  0x5f,  0x53,  0x57,  0x23,  
+	0x0a,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x72,  0x65,  0x6c,  0x61,  0x79,  0x5f,  0x73,  0x77,  
+	0x69,  0x74,  0x63,  0x68,  0x65,  0x73,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x7b,  0x72,  0x65,  0x6c,  
+	0x61,  0x79,  0x3d,  0x22,  0x34,  0x22,  0x7d,  0x20,  
+	0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x4e,  0x5f,  
+	0x53,  0x57,  0x23,  0x0a,  0x23,  0x48,  0x41,  0x53,  
+	0x48,  0x23,  0x20,  0x54,  0x59,  0x50,  0x45,  0x20,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x72,  0x65,  0x6c,  0x61,  0x79,  
+	0x5f,  0x73,  0x77,  0x69,  0x74,  0x63,  0x68,  0x65,  
+	0x73,  0x5f,  0x68,  0x65,  0x6c,  0x64,  0x5f,  0x74,  
+	0x6f,  0x74,  0x61,  0x6c,  0x20,  0x63,  0x6f,  0x75,  
+	0x6e,  0x74,  0x65,  0x72,  0x0a,  0x73,  0x6d,  0x61,  
+	0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  
+	0x72,  0x65,  0x6c,  0x61,  0x79,  0x5f,  0x73,  0x77,  
+	0x69,  0x74,  0x63,  0x68,  0x65,  0x73,  0x5f,  0x68,  
+	0x65,  0x6c,  0x64,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x20,  0x23,  0x53,  0x57,  0x5f,  0x48,  0x45,  
+	0x4c,  0x44,  0x23,  0x0a,  
+#ifdef ENABLE_THERMOMETER
+	0x23,  0x48,  0x41,  0x53,  0x48,  0x23,  0x20,  0x54,  
+	0x59,  0x50,  0x45,  0x20,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x73,  
+	0x65,  0x6e,  0x73,  0x6f,  0x72,  0x5f,  0x63,  0x6f,  
+	0x6e,  0x76,  0x65,  0x72,  0x73,  0x69,  0x6f,  0x6e,  
+	0x73,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x20,  
+	0x63,  0x6f,  0x75,  0x6e,  0x74,  0x65,  0x72,  0x0a,  
+	0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  
+	0x69,  0x70,  0x5f,  0x73,  0x65,  0x6e,  0x73,  0x6f,  
+	0x72,  0x5f,  0x63,  0x6f,  0x6e,  0x76,  0x65,  0x72,  
+	0x73,  0x69,  0x6f,  0x6e,  0x73,  0x5f,  0x74,  0x6f,  
+	0x74,  0x61,  0x6c,  0x20,  0x23,  0x54,  0x48,  0x45,  
+	0x52,  0x4d,  0x4f,  0x5f,  0x43,  0x4f,  0x4e,  0x56,  
+	0x23,  0x0a,  0x23,  0x48,  0x41,  0x53,  0x48,  0x23,  
+	0x20,  0x54,  0x59,  0x50,  0x45,  0x20,  0x73,  0x6d,  
+	0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  
+	0x5f,  0x73,  0x65,  0x6e,  0x73,  0x6f,  0x72,  0x5f,  
+	0x63,  0x6f,  0x6e,  0x76,  0x65,  0x72,  0x73,  0x69,  
+	0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x63,  0x6f,  0x6e,  
+	0x64,  0x73,  0x20,  0x67,  0x61,  0x75,  0x67,  0x65,  
+	0x0a,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  
+	0x72,  0x69,  0x70,  0x5f,  0x73,  0x65,  0x6e,  0x73,  
+	0x6f,  0x72,  0x5f,  0x63,  0x6f,  0x6e,  0x76,  0x65,  
+	0x72,  0x73,  0x69,  0x6f,  0x6e,  0x5f,  0x73,  0x65,  
+	0x63,  0x6f,  0x6e,  0x64,  0x73,  0x20,  0x23,  0x54,  
+	0x48,  0x45,  0x52,  0x4d,  0x4f,  0x5f,  0x43,  0x4f,  
+	0x4e,  0x56,  0x5f,  0x54,  0x49,  0x4d,  0x45,  0x23,  
+	0x0a,  
+#endif
+	0x23,  0x48,  0x41,  0x53,  0x48,  0x23,  0x20,  0x54,  
+	0x59,  0x50,  0x45,  0x20,  0x73,  0x6d,  0x61,  0x72,  
+	0x74,  0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x65,  
+	0x65,  0x70,  0x72,  0x6f,  0x6d,  0x5f,  0x62,  0x79,  
+	0x74,  0x65,  0x73,  0x5f,  0x77,  0x72,  0x69,  0x74,  
+	0x74,  0x65,  0x6e,  0x5f,  0x74,  0x6f,  0x74,  0x61,  
+	0x6c,  0x20,  0x63,  0x6f,  0x75,  0x6e,  0x74,  0x65,  
+	0x72,  0x0a,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  
+	0x74,  0x72,  0x69,  0x70,  0x5f,  0x65,  0x65,  0x70,  
+	0x72,  0x6f,  0x6d,  0x5f,  0x62,  0x79,  0x74,  0x65,  
+	0x73,  0x5f,  0x77,  0x72,  0x69,  0x74,  0x74,  0x65,  
+	0x6e,  0x5f,  0x74,  0x6f,  0x74,  0x61,  0x6c,  0x20,  
+	0x23,  0x45,  0x45,  0x5f,  0x42,  0x59,  0x54,  0x45,  
+	0x53,  0x23,  0x0a,  0x23,  0x48,  0x41,  0x53,  0x48,  
+	0x23,  0x20,  0x54,  0x59,  0x50,  0x45,  0x20,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x66,  0x72,  0x65,  0x65,  0x5f,  0x72,  
+	0x61,  0x6d,  0x5f,  0x62,  0x79,  0x74,  0x65,  0x73,  
+	0x20,  0x67,  0x61,  0x75,  0x67,  0x65,  0x0a,  0x73,  
+	0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  0x72,  0x69,  
+	0x70,  0x5f,  0x66,  0x72,  0x65,  0x65,  0x5f,  0x72,  
+	0x61,  0x6d,  0x5f,  0x62,  0x79,  0x74,  0x65,  0x73,  
+	0x20,  0x23,  0x46,  0x52,  0x45,  0x45,  0x52,  0x41,  
+	0x4d,  0x5f,  0x4e,  0x55,  0x4d,  0x23,  0x0a,  0x23,  
+	0x48,  0x41,  0x53,  0x48,  0x23,  0x20,  0x54,  0x59,  
+	0x50,  0x45,  0x20,  0x73,  0x6d,  0x61,  0x72,  0x74,  
+	0x73,  0x74,  0x72,  0x69,  0x70,  0x5f,  0x66,  0x72,  
+	0x65,  0x65,  0x5f,  0x72,  0x61,  0x6d,  0x5f,  0x6c,  
+	0x6f,  0x77,  0x5f,  0x77,  0x61,  0x74,  0x65,  0x72,  
+	0x6d,  0x61,  0x72,  0x6b,  0x5f,  0x62,  0x79,  0x74,  
+	0x65,  0x73,  0x20,  0x67,  0x61,  0x75,  0x67,  0x65,  
+	0x0a,  0x73,  0x6d,  0x61,  0x72,  0x74,  0x73,  0x74,  
+	0x72,  0x69,  0x70,  0x5f,  0x66,  0x72,  0x65,  0x65,  
+	0x5f,  0x72,  0x61,  0x6d,  0x5f,  0x6c,  0x6f,  0x77,  
+	0x5f,  0x77,  0x61,  0x74,  0x65,  0x72,  0x6d,  0x61,  
+	0x72,  0x6b,  0x5f,  0x62,  0x79,  0x74,  0x65,  0x73,  
+	0x20,  0x23,  0x46,  0x52,  0x45,  0x45,  0x52,  0x41,  
+	0x4d,  0x5f,  0x4c,  0x4f,  0x57,  0x23,  0x0a,  0x00
+};
+
+// unsigned int metrics_len = 6213;
 
 const char net_html_name[] PROGMEM = "/net.html";
 
 const char net_html[] PROGMEM = {
 	0x3c,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x3c,  0x62,  
-	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x66,  0x6f,  0x72,  
-	0x6d,  0x3e,  0x3c,  0x74,  0x61,  0x62,  0x6c,  0x65,  
-	0x20,  0x63,  0x6f,  0x6c,  0x73,  0x3d,  0x22,  0x32,  
-	0x22,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
-	0x64,  0x3e,  0x4d,  0x41,  0x43,  0x20,  0x41,  0x64,  
-	0x64,  0x72,  0x65,  0x73,  0x73,  0x3c,  0x2f,  0x74,  
-	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x69,  
-	0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  
-	0x65,  0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  0x22,  
-	0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6d,  
-	0x61,  0x63,  0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  
-	0x65,  0x3d,  0x22,  0x23,  0x4d,  0x41,  0x43,  0x41,  
-	0x44,  0x44,  0x52,  0x23,  0x22,  0x2f,  0x3e,  0x3c,  
+	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x62,  0x3e,  0x23,  
+	0x46,  0x4f,  0x52,  0x4d,  0x5f,  0x45,  0x52,  0x52,  
+	0x23,  0x3c,  0x2f,  0x62,  0x3e,  0x3c,  0x66,  0x6f,  
+	0x72,  0x6d,  0x3e,  0x3c,  0x74,  0x61,  0x62,  0x6c,  
+	0x65,  0x20,  0x63,  0x6f,  0x6c,  0x73,  0x3d,  0x22,  
+	0x32,  0x22,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x4d,  0x41,  0x43,  0x20,  0x41,  
+	0x64,  0x64,  0x72,  0x65,  0x73,  0x73,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  
+	0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  
+	0x70,  0x65,  0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  
+	0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  
+	0x6d,  0x61,  0x63,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x23,  0x4d,  0x41,  0x43,  
+	0x41,  0x44,  0x44,  0x52,  0x23,  0x22,  0x2f,  0x3e,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x4d,  0x6f,  0x64,  0x65,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  
+	0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  
+	0x70,  0x65,  0x3d,  0x22,  0x72,  0x61,  0x64,  0x69,  
+	0x6f,  0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  
+	0x22,  0x6d,  0x6f,  0x64,  0x65,  0x22,  0x20,  0x76,  
+	0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x64,  0x68,  
+	0x63,  0x70,  0x22,  0x20,  0x23,  0x4e,  0x45,  0x54,  
+	0x4d,  0x4f,  0x44,  0x45,  0x5f,  0x44,  0x48,  0x43,  
+	0x50,  0x5f,  0x43,  0x48,  0x4b,  0x23,  0x2f,  0x3e,  
+	0x44,  0x48,  0x43,  0x50,  0x3c,  0x69,  0x6e,  0x70,  
+	0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  
+	0x22,  0x72,  0x61,  0x64,  0x69,  0x6f,  0x22,  0x20,  
+	0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6d,  0x6f,  
+	0x64,  0x65,  0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  
+	0x65,  0x3d,  0x22,  0x73,  0x74,  0x61,  0x74,  0x69,  
+	0x63,  0x22,  0x20,  0x23,  0x4e,  0x45,  0x54,  0x4d,  
+	0x4f,  0x44,  0x45,  0x5f,  0x53,  0x54,  0x41,  0x54,  
+	0x49,  0x43,  0x5f,  0x43,  0x48,  0x4b,  0x23,  0x2f,  
+	0x3e,  0x53,  0x74,  0x61,  0x74,  0x69,  0x63,  0x3c,  
 	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  
 	0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  
-	0x3e,  0x4d,  0x6f,  0x64,  0x65,  0x3c,  0x2f,  0x74,  
-	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x69,  
-	0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  
-	0x65,  0x3d,  0x22,  0x72,  0x61,  0x64,  0x69,  0x6f,  
-	0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  
-	0x6d,  0x6f,  0x64,  0x65,  0x22,  0x20,  0x76,  0x61,  
-	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x64,  0x68,  0x63,  
-	0x70,  0x22,  0x20,  0x23,  0x4e,  0x45,  0x54,  0x4d,  
-	0x4f,  0x44,  0x45,  0x5f,  0x44,  0x48,  0x43,  0x50,  
-	0x5f,  0x43,  0x48,  0x4b,  0x23,  0x2f,  0x3e,  0x44,  
-	0x48,  0x43,  0x50,  0x3c,  0x69,  0x6e,  0x70,  0x75,  
-	0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  
-	0x72,  0x61,  0x64,  0x69,  0x6f,  0x22,  0x20,  0x6e,  
-	0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6d,  0x6f,  0x64,  
-	0x65,  0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  
-	0x3d,  0x22,  0x73,  0x74,  0x61,  0x74,  0x69,  0x63,  
-	0x22,  0x20,  0x23,  0x4e,  0x45,  0x54,  0x4d,  0x4f,  
-	0x44,  0x45,  0x5f,  0x53,  0x54,  0x41,  0x54,  0x49,  
-	0x43,  0x5f,  0x43,  0x48,  0x4b,  0x23,  0x2f,  0x3e,  
-	0x53,  0x74,  0x61,  0x74,  0x69,  0x63,  0x3c,  0x2f,  
-	0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  0x3e,  
-	0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
-	0x49,  0x50,  0x20,  0x41,  0x64,  0x64,  0x72,  0x65,  
-	0x73,  0x73,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
-	0x74,  0x64,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  
-	0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  
-	0x74,  0x65,  0x78,  0x74,  0x22,  0x20,  0x6e,  0x61,  
-	0x6d,  0x65,  0x3d,  0x22,  0x69,  0x70,  0x22,  0x20,  
-	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x23,  
-	0x4e,  0x45,  0x54,  0x5f,  0x49,  0x50,  0x23,  0x22,  
-	0x2f,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
-	0x2f,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  
-	0x3c,  0x74,  0x64,  0x3e,  0x4e,  0x65,  0x74,  0x6d,  
-	0x61,  0x73,  0x6b,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3e,  0x49,  0x50,  0x20,  0x41,  0x64,  0x64,  0x72,  
+	0x65,  0x73,  0x73,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
 	0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  
 	0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  
 	0x22,  0x74,  0x65,  0x78,  0x74,  0x22,  0x20,  0x6e,  
-	0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6d,  0x61,  0x73,  
-	0x6b,  0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  
-	0x3d,  0x22,  0x23,  0x4e,  0x45,  0x54,  0x5f,  0x4d,  
-	0x41,  0x53,  0x4b,  0x23,  0x22,  0x2f,  0x3e,  0x3c,  
-	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  
-	0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  
-	0x3e,  0x44,  0x65,  0x66,  0x61,  0x75,  0x6c,  0x74,  
-	0x20,  0x47,  0x61,  0x74,  0x65,  0x77,  0x61,  0x79,  
-	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  
-	0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  
-	0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x74,  0x65,  
-	0x78,  0x74,  0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  
-	0x3d,  0x22,  0x67,  0x77,  0x22,  0x20,  0x76,  0x61,  
-	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x23,  0x4e,  0x45,  
-	0x54,  0x5f,  0x47,  0x57,  0x23,  0x22,  0x2f,  0x3e,  
+	0x61,  0x6d,  0x65,  0x3d,  0x22,  0x69,  0x70,  0x22,  
+	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
+	0x23,  0x4e,  0x45,  0x54,  0x5f,  0x49,  0x50,  0x23,  
+	0x22,  0x2f,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3c,  0x2f,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  
+	0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x4e,  0x65,  0x74,  
+	0x6d,  0x61,  0x73,  0x6b,  0x3c,  0x2f,  0x74,  0x64,  
+	0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x69,  0x6e,  
+	0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  
+	0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  0x22,  0x20,  
+	0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6d,  0x61,  
+	0x73,  0x6b,  0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  
+	0x65,  0x3d,  0x22,  0x23,  0x4e,  0x45,  0x54,  0x5f,  
+	0x4d,  0x41,  0x53,  0x4b,  0x23,  0x22,  0x2f,  0x3e,  
 	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  
-	0x72,  0x3e,  0x3c,  0x2f,  0x74,  0x61,  0x62,  0x6c,  
-	0x65,  0x3e,  0x3c,  0x62,  0x72,  0x20,  0x2f,  0x3e,  
+	0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x44,  0x65,  0x66,  0x61,  0x75,  0x6c,  
+	0x74,  0x20,  0x47,  0x61,  0x74,  0x65,  0x77,  0x61,  
+	0x79,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  
+	0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x74,  
+	0x65,  0x78,  0x74,  0x22,  0x20,  0x6e,  0x61,  0x6d,  
+	0x65,  0x3d,  0x22,  0x67,  0x77,  0x22,  0x20,  0x76,  
+	0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x23,  0x4e,  
+	0x45,  0x54,  0x5f,  0x47,  0x57,  0x23,  0x22,  0x2f,  
+	0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x72,  0x3e,  0x3c,  0x2f,  0x74,  0x61,  0x62,  
+	0x6c,  0x65,  0x3e,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  
 	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
 	0x79,  0x70,  0x65,  0x3d,  0x22,  0x73,  0x75,  0x62,  
 	0x6d,  0x69,  0x74,  0x22,  0x20,  0x76,  0x61,  0x6c,  
 	0x75,  0x65,  0x3d,  0x22,  0x53,  0x61,  0x76,  0x65,  
-	0x22,  0x20,  0x2f,  0x3e,  0x3c,  0x2f,  0x66,  0x6f,  
-	0x72,  0x6d,  0x3e,  0x3c,  0x2f,  0x62,  0x6f,  0x64,  
-	0x79,  0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  
-	0x3e,  0x00
+	0x22,  0x2f,  0x3e,  0x3c,  0x2f,  0x66,  0x6f,  0x72,  
+	0x6d,  0x3e,  0x3c,  0x2f,  0x62,  0x6f,  0x64,  0x79,  
+	0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  
+	0x00
 };
 
-// unsigned int net_html_len = 626;
+// unsigned int net_html_len = 641;
 
 const char opts_html_name[] PROGMEM = "/opts.html";
 
 const char opts_html[] PROGMEM = {
 	0x3c,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x3c,  0x62,  
-	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x66,  0x6f,  0x72,  
-	0x6d,  0x3e,  0x3c,  0x74,  0x61,  0x62,  0x6c,  0x65,  
-	0x20,  0x63,  0x6f,  0x6c,  0x73,  0x3d,  0x22,  0x32,  
-	0x22,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
-	0x64,  0x3e,  0x44,  0x65,  0x6c,  0x61,  0x79,  0x3c,  
-	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
-	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
-	0x79,  0x70,  0x65,  0x3d,  0x22,  0x74,  0x65,  0x78,  
-	0x74,  0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  
-	0x22,  0x64,  0x65,  0x6c,  0x61,  0x79,  0x22,  0x20,  
-	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x23,  
-	0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  0x44,  0x45,  
-	0x4c,  0x41,  0x59,  0x23,  0x22,  0x2f,  0x3e,  0x3c,  
-	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  
-	0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  
-	0x3e,  0x48,  0x79,  0x73,  0x74,  0x65,  0x72,  0x65,  
-	0x73,  0x69,  0x73,  0x20,  0x4d,  0x61,  0x72,  0x67,  
-	0x69,  0x6e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x62,  0x3e,  0x23,  
+	0x46,  0x4f,  0x52,  0x4d,  0x5f,  0x45,  0x52,  0x52,  
+	0x23,  0x3c,  0x2f,  0x62,  0x3e,  0x3c,  0x66,  0x6f,  
+	0x72,  0x6d,  0x3e,  0x3c,  0x74,  0x61,  0x62,  0x6c,  
+	0x65,  0x20,  0x63,  0x6f,  0x6c,  0x73,  0x3d,  0x22,  
+	0x32,  0x22,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x4d,  0x69,  0x6e,  0x69,  0x6d,  
+	0x75,  0x6d,  0x20,  0x74,  0x69,  0x6d,  0x65,  0x20,  
+	0x62,  0x65,  0x74,  0x77,  0x65,  0x65,  0x6e,  0x20,  
+	0x73,  0x77,  0x69,  0x74,  0x63,  0x68,  0x65,  0x73,  
+	0x20,  0x28,  0x6d,  0x69,  0x6e,  0x75,  0x74,  0x65,  
+	0x73,  0x29,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
 	0x74,  0x64,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  
 	0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  
 	0x74,  0x65,  0x78,  0x74,  0x22,  0x20,  0x6e,  0x61,  
-	0x6d,  0x65,  0x3d,  0x22,  0x68,  0x79,  0x73,  0x74,  
-	0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
-	0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  
-	0x4d,  0x41,  0x52,  0x47,  0x49,  0x4e,  0x23,  0x22,  
+	0x6d,  0x65,  0x3d,  0x22,  0x64,  0x65,  0x6c,  0x61,  
+	0x79,  0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  
+	0x3d,  0x22,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x5f,  0x44,  0x45,  0x4c,  0x41,  0x59,  0x23,  0x22,  
 	0x2f,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x2f,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  
+	0x3c,  0x74,  0x64,  0x3e,  0x48,  0x79,  0x73,  0x74,  
+	0x65,  0x72,  0x65,  0x73,  0x69,  0x73,  0x20,  0x4d,  
+	0x61,  0x72,  0x67,  0x69,  0x6e,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x69,  
+	0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  
+	0x65,  0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  0x22,  
+	0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x68,  
+	0x79,  0x73,  0x74,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x23,  0x52,  0x45,  0x4c,  
+	0x41,  0x59,  0x5f,  0x4d,  0x41,  0x52,  0x47,  0x49,  
+	0x4e,  0x23,  0x22,  0x2f,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  0x3e,  0x3c,  
+	0x2f,  0x74,  0x61,  0x62,  0x6c,  0x65,  0x3e,  0x3c,  
+	0x62,  0x72,  0x2f,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  
+	0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  
+	0x22,  0x73,  0x75,  0x62,  0x6d,  0x69,  0x74,  0x22,  
+	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
+	0x53,  0x61,  0x76,  0x65,  0x22,  0x2f,  0x3e,  0x3c,  
+	0x2f,  0x66,  0x6f,  0x72,  0x6d,  0x3e,  0x3c,  0x2f,  
+	0x62,  0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x2f,  0x68,  
+	0x74,  0x6d,  0x6c,  0x3e,  0x00
+};
+
+// unsigned int opts_html_len = 341;
+
+const char scenes_html_name[] PROGMEM = "/scenes.html";
+
+const char scenes_html[] PROGMEM = {
+	0x3c,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x3c,  0x62,  
+	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x68,  0x33,  0x3e,  
+	0x53,  0x63,  0x65,  0x6e,  0x65,  0x73,  0x3c,  0x2f,  
+	0x68,  0x33,  0x3e,  0x3c,  0x62,  0x3e,  0x23,  0x46,  
+	0x4f,  0x52,  0x4d,  0x5f,  0x45,  0x52,  0x52,  0x23,  
+	0x3c,  0x2f,  0x62,  0x3e,  0x3c,  0x74,  0x61,  0x62,  
+	0x6c,  0x65,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x68,  0x3e,  0x53,  0x63,  0x65,  0x6e,  0x65,  
+	0x3c,  0x2f,  0x74,  0x68,  0x3e,  0x3c,  0x74,  0x68,  
+	0x3e,  0x4e,  0x61,  0x6d,  0x65,  0x3c,  0x2f,  0x74,  
+	0x68,  0x3e,  0x3c,  0x74,  0x68,  0x3e,  0x53,  0x6f,  
+	0x63,  0x6b,  0x65,  0x74,  0x73,  0x3c,  0x2f,  0x74,  
+	0x68,  0x3e,  0x3c,  0x74,  0x68,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x68,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  0x3e,  
+	0x23,  0x53,  0x43,  0x45,  0x4e,  0x45,  0x5f,  0x4e,  
+	0x45,  0x58,  0x54,  0x23,  0x3c,  0x74,  0x72,  0x3e,  
+	0x3c,  0x74,  0x64,  0x3e,  0x31,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x53,  
+	0x43,  0x45,  0x4e,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  
+	0x4d,  0x45,  0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x74,  0x3e,  
+	0x23,  0x53,  0x43,  0x45,  0x4e,  0x45,  0x4e,  0x5f,  
+	0x4d,  0x4f,  0x44,  0x45,  0x53,  0x23,  0x3c,  0x2f,  
+	0x74,  0x74,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x61,  0x20,  0x68,  
+	0x72,  0x65,  0x66,  0x3d,  0x22,  0x73,  0x63,  0x65,  
+	0x6e,  0x65,  0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  
+	0x3f,  0x73,  0x63,  0x65,  0x6e,  0x65,  0x3d,  0x31,  
+	0x26,  0x61,  0x63,  0x74,  0x3d,  0x61,  0x70,  0x70,  
+	0x6c,  0x79,  0x22,  0x3e,  0x41,  0x70,  0x70,  0x6c,  
+	0x79,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  0x3e,  0x23,  
+	0x53,  0x43,  0x45,  0x4e,  0x45,  0x5f,  0x4e,  0x45,  
+	0x58,  0x54,  0x23,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x32,  0x3c,  0x2f,  0x74,  0x64,  
+	0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x53,  0x43,  
+	0x45,  0x4e,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  
+	0x45,  0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x3c,  0x74,  0x74,  0x3e,  0x23,  
+	0x53,  0x43,  0x45,  0x4e,  0x45,  0x4e,  0x5f,  0x4d,  
+	0x4f,  0x44,  0x45,  0x53,  0x23,  0x3c,  0x2f,  0x74,  
+	0x74,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x3c,  0x61,  0x20,  0x68,  0x72,  
+	0x65,  0x66,  0x3d,  0x22,  0x73,  0x63,  0x65,  0x6e,  
+	0x65,  0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x3f,  
+	0x73,  0x63,  0x65,  0x6e,  0x65,  0x3d,  0x32,  0x26,  
+	0x61,  0x63,  0x74,  0x3d,  0x61,  0x70,  0x70,  0x6c,  
+	0x79,  0x22,  0x3e,  0x41,  0x70,  0x70,  0x6c,  0x79,  
+	0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  
+	0x3e,  0x3c,  0x2f,  0x74,  0x72,  0x3e,  0x23,  0x53,  
+	0x43,  0x45,  0x4e,  0x45,  0x5f,  0x4e,  0x45,  0x58,  
+	0x54,  0x23,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x33,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3c,  0x74,  0x64,  0x3e,  0x23,  0x53,  0x43,  0x45,  
+	0x4e,  0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  
+	0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x74,  0x3e,  0x23,  0x53,  
+	0x43,  0x45,  0x4e,  0x45,  0x4e,  0x5f,  0x4d,  0x4f,  
+	0x44,  0x45,  0x53,  0x23,  0x3c,  0x2f,  0x74,  0x74,  
+	0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x3c,  0x61,  0x20,  0x68,  0x72,  0x65,  
+	0x66,  0x3d,  0x22,  0x73,  0x63,  0x65,  0x6e,  0x65,  
+	0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x3f,  0x73,  
+	0x63,  0x65,  0x6e,  0x65,  0x3d,  0x33,  0x26,  0x61,  
+	0x63,  0x74,  0x3d,  0x61,  0x70,  0x70,  0x6c,  0x79,  
+	0x22,  0x3e,  0x41,  0x70,  0x70,  0x6c,  0x79,  0x3c,  
+	0x2f,  0x61,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3c,  0x2f,  0x74,  0x72,  0x3e,  0x23,  0x53,  0x43,  
+	0x45,  0x4e,  0x45,  0x5f,  0x4e,  0x45,  0x58,  0x54,  
+	0x23,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x34,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x23,  0x53,  0x43,  0x45,  0x4e,  
+	0x45,  0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x3c,  0x74,  0x74,  0x3e,  0x23,  0x53,  0x43,  
+	0x45,  0x4e,  0x45,  0x4e,  0x5f,  0x4d,  0x4f,  0x44,  
+	0x45,  0x53,  0x23,  0x3c,  0x2f,  0x74,  0x74,  0x3e,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x3c,  0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  
+	0x3d,  0x22,  0x73,  0x63,  0x65,  0x6e,  0x65,  0x73,  
+	0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x3f,  0x73,  0x63,  
+	0x65,  0x6e,  0x65,  0x3d,  0x34,  0x26,  0x61,  0x63,  
+	0x74,  0x3d,  0x61,  0x70,  0x70,  0x6c,  0x79,  0x22,  
+	0x3e,  0x41,  0x70,  0x70,  0x6c,  0x79,  0x3c,  0x2f,  
+	0x61,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
 	0x2f,  0x74,  0x72,  0x3e,  0x3c,  0x2f,  0x74,  0x61,  
-	0x62,  0x6c,  0x65,  0x3e,  0x3c,  0x62,  0x72,  0x20,  
+	0x62,  0x6c,  0x65,  0x3e,  0x3c,  0x70,  0x3e,  0x41,  
+	0x20,  0x63,  0x68,  0x61,  0x72,  0x61,  0x63,  0x74,  
+	0x65,  0x72,  0x20,  0x70,  0x65,  0x72,  0x20,  0x73,  
+	0x6f,  0x63,  0x6b,  0x65,  0x74,  0x3a,  0x20,  0x49,  
+	0x20,  0x6d,  0x65,  0x61,  0x6e,  0x73,  0x20,  0x4f,  
+	0x4e,  0x2c,  0x20,  0x4f,  0x20,  0x4f,  0x46,  0x46,  
+	0x2c,  0x20,  0x47,  0x20,  0x61,  0x6e,  0x64,  0x20,  
+	0x4c,  0x20,  0x61,  0x62,  0x6f,  0x76,  0x65,  0x20,  
+	0x61,  0x6e,  0x64,  0x20,  0x62,  0x65,  0x6c,  0x6f,  
+	0x77,  0x20,  0x61,  0x20,  0x74,  0x65,  0x6d,  0x70,  
+	0x65,  0x72,  0x61,  0x74,  0x75,  0x72,  0x65,  0x2c,  
+	0x20,  0x53,  0x20,  0x73,  0x63,  0x68,  0x65,  0x64,  
+	0x75,  0x6c,  0x65,  0x2c,  0x20,  0x2e,  0x20,  0x75,  
+	0x6e,  0x63,  0x68,  0x61,  0x6e,  0x67,  0x65,  0x64,  
+	0x2e,  0x3c,  0x2f,  0x70,  0x3e,  0x3c,  0x66,  0x6f,  
+	0x72,  0x6d,  0x20,  0x6d,  0x65,  0x74,  0x68,  0x6f,  
+	0x64,  0x3d,  0x22,  0x67,  0x65,  0x74,  0x22,  0x3e,  
+	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
+	0x79,  0x70,  0x65,  0x3d,  0x22,  0x68,  0x69,  0x64,  
+	0x64,  0x65,  0x6e,  0x22,  0x20,  0x6e,  0x61,  0x6d,  
+	0x65,  0x3d,  0x22,  0x61,  0x63,  0x74,  0x22,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x73,  
+	0x61,  0x76,  0x65,  0x22,  0x2f,  0x3e,  0x53,  0x61,  
+	0x76,  0x65,  0x20,  0x74,  0x68,  0x65,  0x20,  0x63,  
+	0x75,  0x72,  0x72,  0x65,  0x6e,  0x74,  0x20,  0x6d,  
+	0x6f,  0x64,  0x65,  0x73,  0x20,  0x61,  0x73,  0x20,  
+	0x73,  0x63,  0x65,  0x6e,  0x65,  0x3c,  0x73,  0x65,  
+	0x6c,  0x65,  0x63,  0x74,  0x20,  0x6e,  0x61,  0x6d,  
+	0x65,  0x3d,  0x22,  0x73,  0x63,  0x65,  0x6e,  0x65,  
+	0x22,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  
+	0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
+	0x22,  0x31,  0x22,  0x3e,  0x31,  0x3c,  0x2f,  0x6f,  
+	0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  
+	0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  
+	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x32,  0x22,  0x3e,  
+	0x32,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  
+	0x6e,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  
+	0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
+	0x22,  0x33,  0x22,  0x3e,  0x33,  0x3c,  0x2f,  0x6f,  
+	0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  
+	0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  
+	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x34,  0x22,  0x3e,  
+	0x34,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  
+	0x6e,  0x3e,  0x3c,  0x2f,  0x73,  0x65,  0x6c,  0x65,  
+	0x63,  0x74,  0x3e,  0x6e,  0x61,  0x6d,  0x65,  0x64,  
+	0x20,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  
+	0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6e,  0x61,  
+	0x6d,  0x65,  0x22,  0x20,  0x73,  0x69,  0x7a,  0x65,  
+	0x3d,  0x22,  0x38,  0x22,  0x20,  0x6d,  0x61,  0x78,  
+	0x6c,  0x65,  0x6e,  0x67,  0x74,  0x68,  0x3d,  0x22,  
+	0x38,  0x22,  0x2f,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  
+	0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  
+	0x22,  0x73,  0x75,  0x62,  0x6d,  0x69,  0x74,  0x22,  
+	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
+	0x53,  0x61,  0x76,  0x65,  0x22,  0x2f,  0x3e,  0x3c,  
+	0x2f,  0x66,  0x6f,  0x72,  0x6d,  0x3e,  0x3c,  0x68,  
+	0x33,  0x3e,  0x47,  0x72,  0x6f,  0x75,  0x70,  0x73,  
+	0x3c,  0x2f,  0x68,  0x33,  0x3e,  0x3c,  0x74,  0x61,  
+	0x62,  0x6c,  0x65,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  
+	0x3c,  0x74,  0x68,  0x3e,  0x47,  0x72,  0x6f,  0x75,  
+	0x70,  0x3c,  0x2f,  0x74,  0x68,  0x3e,  0x3c,  0x74,  
+	0x68,  0x3e,  0x4e,  0x61,  0x6d,  0x65,  0x3c,  0x2f,  
+	0x74,  0x68,  0x3e,  0x3c,  0x74,  0x68,  0x3e,  0x53,  
+	0x6f,  0x63,  0x6b,  0x65,  0x74,  0x73,  0x3c,  0x2f,  
+	0x74,  0x68,  0x3e,  0x3c,  0x74,  0x68,  0x3e,  0x3c,  
+	0x2f,  0x74,  0x68,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  
+	0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  0x50,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x3c,  0x74,  0x72,  
+	0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x31,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  
+	0x47,  0x52,  0x4f,  0x55,  0x50,  0x4e,  0x5f,  0x4e,  
+	0x41,  0x4d,  0x45,  0x23,  0x3c,  0x2f,  0x74,  0x64,  
+	0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x74,  
+	0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  0x50,  0x4e,  
+	0x5f,  0x4d,  0x45,  0x4d,  0x42,  0x45,  0x52,  0x53,  
+	0x23,  0x3c,  0x2f,  0x74,  0x74,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  
+	0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  
+	0x73,  0x63,  0x65,  0x6e,  0x65,  0x73,  0x2e,  0x68,  
+	0x74,  0x6d,  0x6c,  0x3f,  0x67,  0x72,  0x6f,  0x75,  
+	0x70,  0x3d,  0x31,  0x26,  0x61,  0x63,  0x74,  0x3d,  
+	0x6f,  0x6e,  0x22,  0x3e,  0x4f,  0x4e,  0x3c,  0x2f,  
+	0x61,  0x3e,  0x20,  0x3c,  0x61,  0x20,  0x68,  0x72,  
+	0x65,  0x66,  0x3d,  0x22,  0x73,  0x63,  0x65,  0x6e,  
+	0x65,  0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x3f,  
+	0x67,  0x72,  0x6f,  0x75,  0x70,  0x3d,  0x31,  0x26,  
+	0x61,  0x63,  0x74,  0x3d,  0x6f,  0x66,  0x66,  0x22,  
+	0x3e,  0x4f,  0x46,  0x46,  0x3c,  0x2f,  0x61,  0x3e,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x72,  0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  0x50,  
+	0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x3c,  0x74,  
+	0x72,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x32,  0x3c,  
+	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x23,  0x47,  0x52,  0x4f,  0x55,  0x50,  0x4e,  0x5f,  
+	0x4e,  0x41,  0x4d,  0x45,  0x23,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  0x74,  
+	0x74,  0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  0x50,  
+	0x4e,  0x5f,  0x4d,  0x45,  0x4d,  0x42,  0x45,  0x52,  
+	0x53,  0x23,  0x3c,  0x2f,  0x74,  0x74,  0x3e,  0x3c,  
+	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x3c,  0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  
+	0x22,  0x73,  0x63,  0x65,  0x6e,  0x65,  0x73,  0x2e,  
+	0x68,  0x74,  0x6d,  0x6c,  0x3f,  0x67,  0x72,  0x6f,  
+	0x75,  0x70,  0x3d,  0x32,  0x26,  0x61,  0x63,  0x74,  
+	0x3d,  0x6f,  0x6e,  0x22,  0x3e,  0x4f,  0x4e,  0x3c,  
+	0x2f,  0x61,  0x3e,  0x20,  0x3c,  0x61,  0x20,  0x68,  
+	0x72,  0x65,  0x66,  0x3d,  0x22,  0x73,  0x63,  0x65,  
+	0x6e,  0x65,  0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  
+	0x3f,  0x67,  0x72,  0x6f,  0x75,  0x70,  0x3d,  0x32,  
+	0x26,  0x61,  0x63,  0x74,  0x3d,  0x6f,  0x66,  0x66,  
+	0x22,  0x3e,  0x4f,  0x46,  0x46,  0x3c,  0x2f,  0x61,  
+	0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x72,  0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  
+	0x50,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  0x3c,  
+	0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x33,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  0x50,  0x4e,  
+	0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x3c,  
+	0x74,  0x74,  0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  
+	0x50,  0x4e,  0x5f,  0x4d,  0x45,  0x4d,  0x42,  0x45,  
+	0x52,  0x53,  0x23,  0x3c,  0x2f,  0x74,  0x74,  0x3e,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x3c,  0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  
+	0x3d,  0x22,  0x73,  0x63,  0x65,  0x6e,  0x65,  0x73,  
+	0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x3f,  0x67,  0x72,  
+	0x6f,  0x75,  0x70,  0x3d,  0x33,  0x26,  0x61,  0x63,  
+	0x74,  0x3d,  0x6f,  0x6e,  0x22,  0x3e,  0x4f,  0x4e,  
+	0x3c,  0x2f,  0x61,  0x3e,  0x20,  0x3c,  0x61,  0x20,  
+	0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  0x73,  0x63,  
+	0x65,  0x6e,  0x65,  0x73,  0x2e,  0x68,  0x74,  0x6d,  
+	0x6c,  0x3f,  0x67,  0x72,  0x6f,  0x75,  0x70,  0x3d,  
+	0x33,  0x26,  0x61,  0x63,  0x74,  0x3d,  0x6f,  0x66,  
+	0x66,  0x22,  0x3e,  0x4f,  0x46,  0x46,  0x3c,  0x2f,  
+	0x61,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x2f,  0x74,  0x72,  0x3e,  0x23,  0x47,  0x52,  0x4f,  
+	0x55,  0x50,  0x5f,  0x4e,  0x45,  0x58,  0x54,  0x23,  
+	0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x34,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x23,  0x47,  0x52,  0x4f,  0x55,  0x50,  
+	0x4e,  0x5f,  0x4e,  0x41,  0x4d,  0x45,  0x23,  0x3c,  
+	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x3c,  0x74,  0x74,  0x3e,  0x23,  0x47,  0x52,  0x4f,  
+	0x55,  0x50,  0x4e,  0x5f,  0x4d,  0x45,  0x4d,  0x42,  
+	0x45,  0x52,  0x53,  0x23,  0x3c,  0x2f,  0x74,  0x74,  
+	0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x3c,  0x61,  0x20,  0x68,  0x72,  0x65,  
+	0x66,  0x3d,  0x22,  0x73,  0x63,  0x65,  0x6e,  0x65,  
+	0x73,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  0x3f,  0x67,  
+	0x72,  0x6f,  0x75,  0x70,  0x3d,  0x34,  0x26,  0x61,  
+	0x63,  0x74,  0x3d,  0x6f,  0x6e,  0x22,  0x3e,  0x4f,  
+	0x4e,  0x3c,  0x2f,  0x61,  0x3e,  0x20,  0x3c,  0x61,  
+	0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  0x73,  
+	0x63,  0x65,  0x6e,  0x65,  0x73,  0x2e,  0x68,  0x74,  
+	0x6d,  0x6c,  0x3f,  0x67,  0x72,  0x6f,  0x75,  0x70,  
+	0x3d,  0x34,  0x26,  0x61,  0x63,  0x74,  0x3d,  0x6f,  
+	0x66,  0x66,  0x22,  0x3e,  0x4f,  0x46,  0x46,  0x3c,  
+	0x2f,  0x61,  0x3e,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3c,  0x2f,  0x74,  0x72,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x61,  0x62,  0x6c,  0x65,  0x3e,  0x3c,  0x66,  0x6f,  
+	0x72,  0x6d,  0x20,  0x6d,  0x65,  0x74,  0x68,  0x6f,  
+	0x64,  0x3d,  0x22,  0x67,  0x65,  0x74,  0x22,  0x3e,  
+	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
+	0x79,  0x70,  0x65,  0x3d,  0x22,  0x68,  0x69,  0x64,  
+	0x64,  0x65,  0x6e,  0x22,  0x20,  0x6e,  0x61,  0x6d,  
+	0x65,  0x3d,  0x22,  0x61,  0x63,  0x74,  0x22,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x73,  
+	0x61,  0x76,  0x65,  0x22,  0x2f,  0x3e,  0x47,  0x72,  
+	0x6f,  0x75,  0x70,  0x3c,  0x73,  0x65,  0x6c,  0x65,  
+	0x63,  0x74,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  
+	0x22,  0x67,  0x72,  0x6f,  0x75,  0x70,  0x22,  0x3e,  
+	0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x31,  
+	0x22,  0x3e,  0x31,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  
+	0x65,  0x3d,  0x22,  0x32,  0x22,  0x3e,  0x32,  0x3c,  
+	0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  
+	0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x33,  
+	0x22,  0x3e,  0x33,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  
+	0x65,  0x3d,  0x22,  0x34,  0x22,  0x3e,  0x34,  0x3c,  
+	0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  
+	0x3c,  0x2f,  0x73,  0x65,  0x6c,  0x65,  0x63,  0x74,  
+	0x3e,  0x6e,  0x61,  0x6d,  0x65,  0x64,  0x20,  0x3c,  
+	0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x6e,  0x61,  
+	0x6d,  0x65,  0x3d,  0x22,  0x6e,  0x61,  0x6d,  0x65,  
+	0x22,  0x20,  0x73,  0x69,  0x7a,  0x65,  0x3d,  0x22,  
+	0x38,  0x22,  0x20,  0x6d,  0x61,  0x78,  0x6c,  0x65,  
+	0x6e,  0x67,  0x74,  0x68,  0x3d,  0x22,  0x38,  0x22,  
+	0x2f,  0x3e,  0x69,  0x73,  0x20,  0x6d,  0x61,  0x64,  
+	0x65,  0x20,  0x6f,  0x66,  0x20,  0x73,  0x6f,  0x63,  
+	0x6b,  0x65,  0x74,  0x73,  0x20,  0x3c,  0x69,  0x6e,  
+	0x70,  0x75,  0x74,  0x20,  0x6e,  0x61,  0x6d,  0x65,  
+	0x3d,  0x22,  0x6d,  0x65,  0x6d,  0x62,  0x65,  0x72,  
+	0x73,  0x22,  0x20,  0x73,  0x69,  0x7a,  0x65,  0x3d,  
+	0x22,  0x31,  0x30,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x31,  0x2c,  0x32,  0x22,  
 	0x2f,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  
 	0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x73,  
 	0x75,  0x62,  0x6d,  0x69,  0x74,  0x22,  0x20,  0x76,  
 	0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x53,  0x61,  
-	0x76,  0x65,  0x22,  0x20,  0x2f,  0x3e,  0x3c,  0x2f,  
-	0x66,  0x6f,  0x72,  0x6d,  0x3e,  0x3c,  0x2f,  0x62,  
-	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x2f,  0x68,  0x74,  
-	0x6d,  0x6c,  0x3e,  0x00
+	0x76,  0x65,  0x22,  0x2f,  0x3e,  0x3c,  0x2f,  0x66,  
+	0x6f,  0x72,  0x6d,  0x3e,  0x3c,  0x2f,  0x62,  0x6f,  
+	0x64,  0x79,  0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  
+	0x6c,  0x3e,  0x00
 };
 
-// unsigned int opts_html_len = 292;
+// unsigned int scenes_html_len = 2347;
 
-const char sck_html_name[] PROGMEM = "/sck.html";
+const char sched_html_name[] PROGMEM = "/sched.html";
 
-const char sck_html[] PROGMEM = {
+const char sched_html[] PROGMEM = {
 	0x3c,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x3c,  0x62,  
 	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x68,  0x33,  0x3e,  
-	0x53,  0x6f,  0x63,  0x6b,  0x65,  0x74,  0x20,  0x23,  
-	0x47,  0x45,  0x54,  0x50,  0x5f,  0x72,  0x65,  0x6c,  
-	0x23,  0x3c,  0x2f,  0x68,  0x33,  0x3e,  0x3c,  0x66,  
-	0x6f,  0x72,  0x6d,  0x20,  0x6d,  0x65,  0x74,  0x68,  
-	0x6f,  0x64,  0x3d,  0x22,  0x67,  0x65,  0x74,  0x22,  
+	0x53,  0x63,  0x68,  0x65,  0x64,  0x75,  0x6c,  0x65,  
+	0x20,  0x6f,  0x66,  0x20,  0x73,  0x6f,  0x63,  0x6b,  
+	0x65,  0x74,  0x20,  0x23,  0x47,  0x45,  0x54,  0x50,  
+	0x5f,  0x72,  0x65,  0x6c,  0x23,  0x3c,  0x2f,  0x68,  
+	0x33,  0x3e,  0x3c,  0x62,  0x3e,  0x23,  0x46,  0x4f,  
+	0x52,  0x4d,  0x5f,  0x45,  0x52,  0x52,  0x23,  0x3c,  
+	0x2f,  0x62,  0x3e,  0x3c,  0x70,  0x3e,  0x43,  0x6c,  
+	0x6f,  0x63,  0x6b,  0x3a,  0x20,  0x23,  0x44,  0x41,  
+	0x54,  0x45,  0x23,  0x20,  0x23,  0x54,  0x49,  0x4d,  
+	0x45,  0x23,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  0x53,  
+	0x63,  0x68,  0x65,  0x64,  0x75,  0x6c,  0x65,  0x3a,  
+	0x20,  0x23,  0x53,  0x43,  0x48,  0x45,  0x44,  0x5f,  
+	0x4e,  0x45,  0x58,  0x54,  0x23,  0x3c,  0x2f,  0x70,  
+	0x3e,  0x3c,  0x70,  0x72,  0x65,  0x3e,  0x23,  0x53,  
+	0x43,  0x48,  0x45,  0x44,  0x5f,  0x52,  0x4f,  0x57,  
+	0x23,  0x23,  0x53,  0x43,  0x48,  0x45,  0x44,  0x5f,  
+	0x52,  0x4f,  0x57,  0x23,  0x23,  0x53,  0x43,  0x48,  
+	0x45,  0x44,  0x5f,  0x52,  0x4f,  0x57,  0x23,  0x23,  
+	0x53,  0x43,  0x48,  0x45,  0x44,  0x5f,  0x52,  0x4f,  
+	0x57,  0x23,  0x23,  0x53,  0x43,  0x48,  0x45,  0x44,  
+	0x5f,  0x52,  0x4f,  0x57,  0x23,  0x23,  0x53,  0x43,  
+	0x48,  0x45,  0x44,  0x5f,  0x52,  0x4f,  0x57,  0x23,  
+	0x23,  0x53,  0x43,  0x48,  0x45,  0x44,  0x5f,  0x52,  
+	0x4f,  0x57,  0x23,  0x23,  0x53,  0x43,  0x48,  0x45,  
+	0x44,  0x5f,  0x52,  0x4f,  0x57,  0x23,  0x23,  0x53,  
+	0x43,  0x48,  0x45,  0x44,  0x5f,  0x52,  0x4f,  0x57,  
+	0x23,  0x23,  0x53,  0x43,  0x48,  0x45,  0x44,  0x5f,  
+	0x52,  0x4f,  0x57,  0x23,  0x23,  0x53,  0x43,  0x48,  
+	0x45,  0x44,  0x5f,  0x52,  0x4f,  0x57,  0x23,  0x23,  
+	0x53,  0x43,  0x48,  0x45,  0x44,  0x5f,  0x52,  0x4f,  
+	0x57,  0x23,  0x23,  0x53,  0x43,  0x48,  0x45,  0x44,  
+	0x5f,  0x52,  0x4f,  0x57,  0x23,  0x23,  0x53,  0x43,  
+	0x48,  0x45,  0x44,  0x5f,  0x52,  0x4f,  0x57,  0x23,  
+	0x3c,  0x2f,  0x70,  0x72,  0x65,  0x3e,  0x3c,  0x70,  
+	0x3e,  0x45,  0x76,  0x65,  0x72,  0x79,  0x20,  0x63,  
+	0x68,  0x61,  0x72,  0x61,  0x63,  0x74,  0x65,  0x72,  
+	0x20,  0x69,  0x73,  0x20,  0x33,  0x30,  0x20,  0x6d,  
+	0x69,  0x6e,  0x75,  0x74,  0x65,  0x73,  0x2c,  0x20,  
+	0x73,  0x74,  0x61,  0x72,  0x74,  0x69,  0x6e,  0x67,  
+	0x20,  0x66,  0x72,  0x6f,  0x6d,  0x20,  0x6d,  0x69,  
+	0x64,  0x6e,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  
+	0x2a,  0x20,  0x6d,  0x65,  0x61,  0x6e,  0x73,  0x20,  
+	0x4f,  0x4e,  0x2e,  0x3c,  0x2f,  0x70,  0x3e,  0x3c,  
+	0x66,  0x6f,  0x72,  0x6d,  0x20,  0x6d,  0x65,  0x74,  
+	0x68,  0x6f,  0x64,  0x3d,  0x22,  0x67,  0x65,  0x74,  
+	0x22,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  
+	0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x68,  
+	0x69,  0x64,  0x64,  0x65,  0x6e,  0x22,  0x20,  0x6e,  
+	0x61,  0x6d,  0x65,  0x3d,  0x22,  0x72,  0x65,  0x6c,  
+	0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
+	0x22,  0x23,  0x47,  0x45,  0x54,  0x50,  0x5f,  0x72,  
+	0x65,  0x6c,  0x23,  0x22,  0x2f,  0x3e,  0x3c,  0x73,  
+	0x65,  0x6c,  0x65,  0x63,  0x74,  0x20,  0x6e,  0x61,  
+	0x6d,  0x65,  0x3d,  0x22,  0x61,  0x63,  0x74,  0x22,  
+	0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
+	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
+	0x6f,  0x6e,  0x22,  0x3e,  0x4f,  0x4e,  0x3c,  0x2f,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  
+	0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x6f,  0x66,  
+	0x66,  0x22,  0x3e,  0x4f,  0x46,  0x46,  0x3c,  0x2f,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  
+	0x2f,  0x73,  0x65,  0x6c,  0x65,  0x63,  0x74,  0x3e,  
+	0x6f,  0x6e,  0x3c,  0x73,  0x65,  0x6c,  0x65,  0x63,  
+	0x74,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  
+	0x64,  0x61,  0x79,  0x22,  0x3e,  0x3c,  0x6f,  0x70,  
+	0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x37,  0x22,  0x3e,  0x65,  
+	0x76,  0x65,  0x72,  0x79,  0x20,  0x64,  0x61,  0x79,  
+	0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
+	0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
+	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
+	0x38,  0x22,  0x3e,  0x4d,  0x6f,  0x6e,  0x64,  0x61,  
+	0x79,  0x20,  0x74,  0x6f,  0x20,  0x46,  0x72,  0x69,  
+	0x64,  0x61,  0x79,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  
+	0x65,  0x3d,  0x22,  0x31,  0x22,  0x3e,  0x4d,  0x6f,  
+	0x6e,  0x64,  0x61,  0x79,  0x3c,  0x2f,  0x6f,  0x70,  
+	0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  0x70,  
+	0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x32,  0x22,  0x3e,  0x54,  
+	0x75,  0x65,  0x73,  0x64,  0x61,  0x79,  0x3c,  0x2f,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  
+	0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x33,  0x22,  
+	0x3e,  0x57,  0x65,  0x64,  0x6e,  0x65,  0x73,  0x64,  
+	0x61,  0x79,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  
+	0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  
+	0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  
+	0x3d,  0x22,  0x34,  0x22,  0x3e,  0x54,  0x68,  0x75,  
+	0x72,  0x73,  0x64,  0x61,  0x79,  0x3c,  0x2f,  0x6f,  
+	0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  
+	0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  
+	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x35,  0x22,  0x3e,  
+	0x46,  0x72,  0x69,  0x64,  0x61,  0x79,  0x3c,  0x2f,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  
+	0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x36,  0x22,  
+	0x3e,  0x53,  0x61,  0x74,  0x75,  0x72,  0x64,  0x61,  
+	0x79,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  
+	0x6e,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  
+	0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
+	0x22,  0x30,  0x22,  0x3e,  0x53,  0x75,  0x6e,  0x64,  
+	0x61,  0x79,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  
+	0x6f,  0x6e,  0x3e,  0x3c,  0x2f,  0x73,  0x65,  0x6c,  
+	0x65,  0x63,  0x74,  0x3e,  0x66,  0x72,  0x6f,  0x6d,  
+	0x20,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  
+	0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x66,  0x72,  
+	0x6f,  0x6d,  0x22,  0x20,  0x73,  0x69,  0x7a,  0x65,  
+	0x3d,  0x22,  0x35,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x30,  0x38,  0x3a,  0x30,  
+	0x30,  0x22,  0x2f,  0x3e,  0x74,  0x6f,  0x20,  0x3c,  
+	0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x6e,  0x61,  
+	0x6d,  0x65,  0x3d,  0x22,  0x74,  0x6f,  0x22,  0x20,  
+	0x73,  0x69,  0x7a,  0x65,  0x3d,  0x22,  0x35,  0x22,  
+	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
+	0x31,  0x38,  0x3a,  0x30,  0x30,  0x22,  0x2f,  0x3e,  
+	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
+	0x79,  0x70,  0x65,  0x3d,  0x22,  0x73,  0x75,  0x62,  
+	0x6d,  0x69,  0x74,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x53,  0x61,  0x76,  0x65,  
+	0x22,  0x2f,  0x3e,  0x3c,  0x2f,  0x66,  0x6f,  0x72,  
+	0x6d,  0x3e,  0x3c,  0x66,  0x6f,  0x72,  0x6d,  0x20,  
+	0x6d,  0x65,  0x74,  0x68,  0x6f,  0x64,  0x3d,  0x22,  
+	0x67,  0x65,  0x74,  0x22,  0x3e,  0x3c,  0x69,  0x6e,  
+	0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  
+	0x3d,  0x22,  0x68,  0x69,  0x64,  0x64,  0x65,  0x6e,  
+	0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  
+	0x72,  0x65,  0x6c,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x23,  0x47,  0x45,  0x54,  
+	0x50,  0x5f,  0x72,  0x65,  0x6c,  0x23,  0x22,  0x2f,  
 	0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  
 	0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x68,  0x69,  
 	0x64,  0x64,  0x65,  0x6e,  0x22,  0x20,  0x6e,  0x61,  
-	0x6d,  0x65,  0x3d,  0x22,  0x72,  0x65,  0x6c,  0x22,  
+	0x6d,  0x65,  0x3d,  0x22,  0x61,  0x63,  0x74,  0x22,  
 	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
+	0x63,  0x6c,  0x65,  0x61,  0x72,  0x22,  0x2f,  0x3e,  
+	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
+	0x79,  0x70,  0x65,  0x3d,  0x22,  0x73,  0x75,  0x62,  
+	0x6d,  0x69,  0x74,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x43,  0x6c,  0x65,  0x61,  
+	0x72,  0x20,  0x73,  0x63,  0x68,  0x65,  0x64,  0x75,  
+	0x6c,  0x65,  0x22,  0x2f,  0x3e,  0x3c,  0x2f,  0x66,  
+	0x6f,  0x72,  0x6d,  0x3e,  0x3c,  0x70,  0x3e,  0x3c,  
+	0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  
+	0x73,  0x63,  0x6b,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  
+	0x3f,  0x72,  0x65,  0x6c,  0x3d,  0x23,  0x47,  0x45,  
+	0x54,  0x50,  0x5f,  0x72,  0x65,  0x6c,  0x23,  0x22,  
+	0x3e,  0x42,  0x61,  0x63,  0x6b,  0x20,  0x74,  0x6f,  
+	0x20,  0x73,  0x6f,  0x63,  0x6b,  0x65,  0x74,  0x20,  
 	0x23,  0x47,  0x45,  0x54,  0x50,  0x5f,  0x72,  0x65,  
-	0x6c,  0x23,  0x22,  0x20,  0x2f,  0x3e,  0x3c,  0x69,  
+	0x6c,  0x23,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  
+	0x70,  0x3e,  0x3c,  0x2f,  0x62,  0x6f,  0x64,  0x79,  
+	0x3e,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  
+	0x00
+};
+
+// unsigned int sched_html_len = 1257;
+
+const char sck_html_name[] PROGMEM = "/sck.html";
+
+const char sck_html[] PROGMEM = {
+	0x3c,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x3c,  0x62,  
+	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x68,  0x33,  0x3e,  
+	0x53,  0x6f,  0x63,  0x6b,  0x65,  0x74,  0x20,  0x23,  
+	0x47,  0x45,  0x54,  0x50,  0x5f,  0x72,  0x65,  0x6c,  
+	0x23,  0x3c,  0x2f,  0x68,  0x33,  0x3e,  0x3c,  0x62,  
+	0x3e,  0x23,  0x46,  0x4f,  0x52,  0x4d,  0x5f,  0x45,  
+	0x52,  0x52,  0x23,  0x3c,  0x2f,  0x62,  0x3e,  0x3c,  
+	0x66,  0x6f,  0x72,  0x6d,  0x20,  0x6d,  0x65,  0x74,  
+	0x68,  0x6f,  0x64,  0x3d,  0x22,  0x67,  0x65,  0x74,  
+	0x22,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  
+	0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x68,  
+	0x69,  0x64,  0x64,  0x65,  0x6e,  0x22,  0x20,  0x6e,  
+	0x61,  0x6d,  0x65,  0x3d,  0x22,  0x72,  0x65,  0x6c,  
+	0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
+	0x22,  0x23,  0x47,  0x45,  0x54,  0x50,  0x5f,  0x72,  
+	0x65,  0x6c,  0x23,  0x22,  0x2f,  0x3e,  0x3c,  0x69,  
 	0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  
 	0x65,  0x3d,  0x22,  0x72,  0x61,  0x64,  0x69,  0x6f,  
 	0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  
@@ -383,74 +1938,313 @@ const char sck_html[] PROGMEM = {
 	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x6f,  0x6e,  0x22,  
 	0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  
 	0x4f,  0x4e,  0x5f,  0x43,  0x48,  0x4b,  0x23,  0x2f,  
-	0x3e,  0x4f,  0x4e,  0x3c,  0x62,  0x72,  0x20,  0x2f,  
+	0x3e,  0x4f,  0x4e,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  
+	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
+	0x79,  0x70,  0x65,  0x3d,  0x22,  0x72,  0x61,  0x64,  
+	0x69,  0x6f,  0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  
+	0x3d,  0x22,  0x6d,  0x6f,  0x64,  0x65,  0x22,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x6f,  
+	0x66,  0x66,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  
+	0x41,  0x59,  0x5f,  0x4f,  0x46,  0x46,  0x5f,  0x43,  
+	0x48,  0x4b,  0x23,  0x2f,  0x3e,  0x4f,  0x46,  0x46,  
+	0x3c,  0x62,  0x72,  0x2f,  0x3e,  0x3c,  0x69,  0x6e,  
+	0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  
+	0x3d,  0x22,  0x72,  0x61,  0x64,  0x69,  0x6f,  0x22,  
+	0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6d,  
+	0x6f,  0x64,  0x65,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x73,  0x63,  0x68,  0x65,  
+	0x64,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x53,  0x43,  0x48,  0x45,  0x44,  0x5f,  
+	0x43,  0x48,  0x4b,  0x23,  0x2f,  0x3e,  0x46,  0x6f,  
+	0x6c,  0x6c,  0x6f,  0x77,  0x20,  0x74,  0x68,  0x65,  
+	0x20,  0x3c,  0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  
+	0x3d,  0x22,  0x73,  0x63,  0x68,  0x65,  0x64,  0x2e,  
+	0x68,  0x74,  0x6d,  0x6c,  0x3f,  0x72,  0x65,  0x6c,  
+	0x3d,  0x23,  0x47,  0x45,  0x54,  0x50,  0x5f,  0x72,  
+	0x65,  0x6c,  0x23,  0x22,  0x3e,  0x73,  0x63,  0x68,  
+	0x65,  0x64,  0x75,  0x6c,  0x65,  0x3c,  0x2f,  0x61,  
+	0x3e,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  0x3c,  0x69,  
+	0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  
+	0x65,  0x3d,  0x22,  0x72,  0x61,  0x64,  0x69,  0x6f,  
+	0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  
+	0x6d,  0x6f,  0x64,  0x65,  0x22,  0x20,  0x76,  0x61,  
+	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x74,  0x65,  0x6d,  
+	0x70,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x54,  0x45,  0x4d,  0x50,  0x5f,  0x43,  
+	0x48,  0x4b,  0x23,  0x2f,  0x3e,  0x45,  0x6e,  0x61,  
+	0x62,  0x6c,  0x65,  0x64,  0x20,  0x77,  0x68,  0x65,  
+	0x6e,  0x20,  0x54,  0x3c,  0x73,  0x65,  0x6c,  0x65,  
+	0x63,  0x74,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  
+	0x22,  0x74,  0x68,  0x72,  0x65,  0x73,  0x22,  0x3e,  
+	0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x67,  
+	0x74,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x54,  0x47,  0x54,  0x5f,  0x43,  0x48,  
+	0x4b,  0x23,  0x3e,  0x26,  0x67,  0x74,  0x3b,  0x3c,  
+	0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  
+	0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x6c,  
+	0x74,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x54,  0x4c,  0x54,  0x5f,  0x43,  0x48,  
+	0x4b,  0x23,  0x3e,  0x26,  0x6c,  0x74,  0x3b,  0x3c,  
+	0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  
+	0x3c,  0x2f,  0x73,  0x65,  0x6c,  0x65,  0x63,  0x74,  
 	0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  
-	0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x72,  0x61,  
-	0x64,  0x69,  0x6f,  0x22,  0x20,  0x6e,  0x61,  0x6d,  
-	0x65,  0x3d,  0x22,  0x6d,  0x6f,  0x64,  0x65,  0x22,  
-	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
-	0x6f,  0x66,  0x66,  0x22,  0x20,  0x23,  0x52,  0x45,  
-	0x4c,  0x41,  0x59,  0x5f,  0x4f,  0x46,  0x46,  0x5f,  
-	0x43,  0x48,  0x4b,  0x23,  0x2f,  0x3e,  0x4f,  0x46,  
-	0x46,  0x3c,  0x62,  0x72,  0x20,  0x2f,  0x3e,  0x3c,  
-	0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  
-	0x70,  0x65,  0x3d,  0x22,  0x72,  0x61,  0x64,  0x69,  
-	0x6f,  0x22,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  
-	0x22,  0x6d,  0x6f,  0x64,  0x65,  0x22,  0x20,  0x76,  
-	0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x74,  0x65,  
-	0x6d,  0x70,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  
-	0x41,  0x59,  0x5f,  0x54,  0x45,  0x4d,  0x50,  0x5f,  
-	0x43,  0x48,  0x4b,  0x23,  0x2f,  0x3e,  0x45,  0x6e,  
-	0x61,  0x62,  0x6c,  0x65,  0x64,  0x20,  0x77,  0x68,  
-	0x65,  0x6e,  0x20,  0x54,  0x3c,  0x73,  0x65,  0x6c,  
+	0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x74,  0x65,  
+	0x6d,  0x70,  0x22,  0x20,  0x73,  0x69,  0x7a,  0x65,  
+	0x3d,  0x22,  0x33,  0x22,  0x20,  0x76,  0x61,  0x6c,  
+	0x75,  0x65,  0x3d,  0x22,  0x23,  0x52,  0x45,  0x4c,  
+	0x41,  0x59,  0x5f,  0x54,  0x48,  0x52,  0x45,  0x53,  
+	0x23,  0x22,  0x2f,  0x3e,  0x3c,  0x73,  0x65,  0x6c,  
 	0x65,  0x63,  0x74,  0x20,  0x6e,  0x61,  0x6d,  0x65,  
-	0x3d,  0x22,  0x74,  0x68,  0x72,  0x65,  0x73,  0x22,  
+	0x3d,  0x22,  0x75,  0x6e,  0x69,  0x74,  0x73,  0x22,  
 	0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
 	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
-	0x67,  0x74,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  
-	0x41,  0x59,  0x5f,  0x54,  0x47,  0x54,  0x5f,  0x43,  
-	0x48,  0x4b,  0x23,  0x3e,  0x26,  0x67,  0x74,  0x3b,  
-	0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
-	0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
+	0x43,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  
+	0x59,  0x5f,  0x54,  0x45,  0x4d,  0x50,  0x43,  0x5f,  
+	0x43,  0x48,  0x4b,  0x23,  0x3e,  0x26,  0x64,  0x65,  
+	0x67,  0x3b,  0x43,  0x3c,  0x2f,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  
+	0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  
+	0x65,  0x3d,  0x22,  0x46,  0x22,  0x20,  0x23,  0x52,  
+	0x45,  0x4c,  0x41,  0x59,  0x5f,  0x54,  0x45,  0x4d,  
+	0x50,  0x46,  0x5f,  0x43,  0x48,  0x4b,  0x23,  0x3e,  
+	0x26,  0x64,  0x65,  0x67,  0x3b,  0x46,  0x3c,  0x2f,  
+	0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  
+	0x2f,  0x73,  0x65,  0x6c,  0x65,  0x63,  0x74,  0x3e,  
+	0x6f,  0x6e,  0x20,  0x73,  0x65,  0x6e,  0x73,  0x6f,  
+	0x72,  0x20,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  
+	0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x73,  
+	0x65,  0x6e,  0x73,  0x6f,  0x72,  0x22,  0x20,  0x73,  
+	0x69,  0x7a,  0x65,  0x3d,  0x22,  0x31,  0x22,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x23,  
+	0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  0x53,  0x45,  
+	0x4e,  0x53,  0x4f,  0x52,  0x23,  0x22,  0x2f,  0x3e,  
+	0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x74,  
+	0x79,  0x70,  0x65,  0x3d,  0x22,  0x63,  0x68,  0x65,  
+	0x63,  0x6b,  0x62,  0x6f,  0x78,  0x22,  0x20,  0x6e,  
+	0x61,  0x6d,  0x65,  0x3d,  0x22,  0x6f,  0x6e,  0x6c,  
+	0x79,  0x73,  0x63,  0x68,  0x65,  0x64,  0x22,  0x20,  
+	0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  0x31,  
+	0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  0x41,  0x59,  
+	0x5f,  0x4f,  0x4e,  0x4c,  0x59,  0x53,  0x43,  0x48,  
+	0x45,  0x44,  0x5f,  0x43,  0x48,  0x4b,  0x23,  0x2f,  
+	0x3e,  0x6f,  0x6e,  0x6c,  0x79,  0x20,  0x77,  0x68,  
+	0x69,  0x6c,  0x65,  0x20,  0x74,  0x68,  0x65,  0x20,  
+	0x73,  0x63,  0x68,  0x65,  0x64,  0x75,  0x6c,  0x65,  
+	0x20,  0x69,  0x73,  0x20,  0x61,  0x63,  0x74,  0x69,  
+	0x76,  0x65,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  0x3c,  
+	0x62,  0x72,  0x2f,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  
+	0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  0x3d,  
+	0x22,  0x73,  0x75,  0x62,  0x6d,  0x69,  0x74,  0x22,  
 	0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  0x22,  
-	0x6c,  0x74,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  
-	0x41,  0x59,  0x5f,  0x54,  0x4c,  0x54,  0x5f,  0x43,  
-	0x48,  0x4b,  0x23,  0x3e,  0x26,  0x6c,  0x74,  0x3b,  
-	0x3c,  0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  
-	0x3e,  0x3c,  0x2f,  0x73,  0x65,  0x6c,  0x65,  0x63,  
-	0x74,  0x3e,  0x3c,  0x69,  0x6e,  0x70,  0x75,  0x74,  
-	0x20,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x22,  0x74,  
-	0x65,  0x6d,  0x70,  0x22,  0x20,  0x73,  0x69,  0x7a,  
-	0x65,  0x3d,  0x22,  0x33,  0x22,  0x20,  0x76,  0x61,  
-	0x6c,  0x75,  0x65,  0x3d,  0x22,  0x23,  0x52,  0x45,  
-	0x4c,  0x41,  0x59,  0x5f,  0x54,  0x48,  0x52,  0x45,  
-	0x53,  0x23,  0x22,  0x2f,  0x3e,  0x3c,  0x73,  0x65,  
-	0x6c,  0x65,  0x63,  0x74,  0x20,  0x6e,  0x61,  0x6d,  
-	0x65,  0x3d,  0x22,  0x75,  0x6e,  0x69,  0x74,  0x73,  
-	0x22,  0x3e,  0x3c,  0x6f,  0x70,  0x74,  0x69,  0x6f,  
-	0x6e,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
-	0x22,  0x43,  0x22,  0x20,  0x23,  0x52,  0x45,  0x4c,  
-	0x41,  0x59,  0x5f,  0x54,  0x45,  0x4d,  0x50,  0x43,  
-	0x5f,  0x43,  0x48,  0x4b,  0x23,  0x3e,  0x26,  0x64,  
-	0x65,  0x67,  0x3b,  0x43,  0x3c,  0x2f,  0x6f,  0x70,  
-	0x74,  0x69,  0x6f,  0x6e,  0x3e,  0x3c,  0x6f,  0x70,  
-	0x74,  0x69,  0x6f,  0x6e,  0x20,  0x76,  0x61,  0x6c,  
-	0x75,  0x65,  0x3d,  0x22,  0x46,  0x22,  0x20,  0x23,  
-	0x52,  0x45,  0x4c,  0x41,  0x59,  0x5f,  0x54,  0x45,  
-	0x4d,  0x50,  0x46,  0x5f,  0x43,  0x48,  0x4b,  0x23,  
-	0x3e,  0x26,  0x64,  0x65,  0x67,  0x3b,  0x46,  0x3c,  
-	0x2f,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x3e,  
-	0x3c,  0x2f,  0x73,  0x65,  0x6c,  0x65,  0x63,  0x74,  
-	0x3e,  0x3c,  0x62,  0x72,  0x20,  0x2f,  0x3e,  0x3c,  
-	0x62,  0x72,  0x20,  0x2f,  0x3e,  0x3c,  0x69,  0x6e,  
-	0x70,  0x75,  0x74,  0x20,  0x74,  0x79,  0x70,  0x65,  
-	0x3d,  0x22,  0x73,  0x75,  0x62,  0x6d,  0x69,  0x74,  
-	0x22,  0x20,  0x76,  0x61,  0x6c,  0x75,  0x65,  0x3d,  
-	0x22,  0x53,  0x61,  0x76,  0x65,  0x22,  0x20,  0x2f,  
-	0x3e,  0x3c,  0x2f,  0x66,  0x6f,  0x72,  0x6d,  0x3e,  
-	0x3c,  0x2f,  0x62,  0x6f,  0x64,  0x79,  0x3e,  0x3c,  
-	0x2f,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x00
+	0x53,  0x61,  0x76,  0x65,  0x22,  0x2f,  0x3e,  0x3c,  
+	0x2f,  0x66,  0x6f,  0x72,  0x6d,  0x3e,  0x3c,  0x2f,  
+	0x62,  0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x2f,  0x68,  
+	0x74,  0x6d,  0x6c,  0x3e,  0x00
+};
+
+// unsigned int sck_html_len = 1013;
+
+const char stats_html_name[] PROGMEM = "/stats.html";
+
+const char stats_html[] PROGMEM = {
+	0x3c,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x3c,  0x62,  
+	0x6f,  0x64,  0x79,  0x3e,  0x3c,  0x68,  0x33,  0x3e,  
+	0x53,  0x74,  0x61,  0x74,  0x69,  0x73,  0x74,  0x69,  
+	0x63,  0x73,  0x3c,  0x2f,  0x68,  0x33,  0x3e,  0x3c,  
+	0x74,  0x61,  0x62,  0x6c,  0x65,  0x20,  0x63,  0x6f,  
+	0x6c,  0x73,  0x3d,  0x22,  0x32,  0x22,  0x3e,  0x3c,  
+	0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x4c,  
+	0x6f,  0x6f,  0x70,  0x20,  0x69,  0x74,  0x65,  0x72,  
+	0x61,  0x74,  0x69,  0x6f,  0x6e,  0x73,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  
+	0x4c,  0x4f,  0x4f,  0x50,  0x5f,  0x43,  0x4e,  0x54,  
+	0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x4c,  0x6f,  0x6f,  0x70,  0x20,  
+	0x74,  0x69,  0x6d,  0x65,  0x20,  0x28,  0x6c,  0x61,  
+	0x73,  0x74,  0x2f,  0x61,  0x76,  0x67,  0x2f,  0x6d,  
+	0x61,  0x78,  0x29,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  
+	0x3c,  0x74,  0x64,  0x3e,  0x23,  0x4c,  0x4f,  0x4f,  
+	0x50,  0x5f,  0x4c,  0x41,  0x53,  0x54,  0x23,  0x2f,  
+	0x23,  0x4c,  0x4f,  0x4f,  0x50,  0x5f,  0x41,  0x56,  
+	0x47,  0x23,  0x2f,  0x23,  0x4c,  0x4f,  0x4f,  0x50,  
+	0x5f,  0x4d,  0x41,  0x58,  0x23,  0x20,  0x75,  0x73,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x57,  0x65,  0x62,  0x73,  0x65,  0x72,  
+	0x76,  0x65,  0x72,  0x20,  0x74,  0x69,  0x6d,  0x65,  
+	0x20,  0x28,  0x6c,  0x61,  0x73,  0x74,  0x2f,  0x61,  
+	0x76,  0x67,  0x2f,  0x6d,  0x61,  0x78,  0x29,  0x3c,  
+	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x23,  0x57,  0x45,  0x42,  0x5f,  0x4c,  0x41,  0x53,  
+	0x54,  0x23,  0x2f,  0x23,  0x57,  0x45,  0x42,  0x5f,  
+	0x41,  0x56,  0x47,  0x23,  0x2f,  0x23,  0x57,  0x45,  
+	0x42,  0x5f,  0x4d,  0x41,  0x58,  0x23,  0x20,  0x75,  
+	0x73,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x54,  0x65,  0x6d,  0x70,  0x65,  
+	0x72,  0x61,  0x74,  0x75,  0x72,  0x65,  0x20,  0x73,  
+	0x61,  0x6d,  0x70,  0x6c,  0x69,  0x6e,  0x67,  0x20,  
+	0x69,  0x6e,  0x74,  0x65,  0x72,  0x76,  0x61,  0x6c,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x23,  0x54,  0x48,  0x45,  0x52,  0x4d,  0x4f,  
+	0x5f,  0x49,  0x4e,  0x54,  0x23,  0x20,  0x6d,  0x73,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x54,  0x65,  0x6d,  0x70,  0x65,  0x72,  
+	0x61,  0x74,  0x75,  0x72,  0x65,  0x20,  0x72,  0x65,  
+	0x61,  0x64,  0x69,  0x6e,  0x67,  0x73,  0x20,  0x72,  
+	0x65,  0x6a,  0x65,  0x63,  0x74,  0x65,  0x64,  0x20,  
+	0x28,  0x43,  0x52,  0x43,  0x20,  0x65,  0x72,  0x72,  
+	0x6f,  0x72,  0x73,  0x29,  0x3c,  0x2f,  0x74,  0x64,  
+	0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x54,  0x48,  
+	0x45,  0x52,  0x4d,  0x4f,  0x5f,  0x52,  0x45,  0x4a,  
+	0x23,  0x20,  0x28,  0x23,  0x54,  0x48,  0x45,  0x52,  
+	0x4d,  0x4f,  0x5f,  0x43,  0x52,  0x43,  0x23,  0x29,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x43,  0x6f,  0x6e,  0x74,  0x72,  0x6f,  
+	0x6c,  0x20,  0x74,  0x61,  0x73,  0x6b,  0x20,  0x28,  
+	0x6d,  0x61,  0x78,  0x2f,  0x62,  0x75,  0x64,  0x67,  
+	0x65,  0x74,  0x2c,  0x20,  0x6f,  0x76,  0x65,  0x72,  
+	0x72,  0x75,  0x6e,  0x73,  0x29,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x54,  
+	0x41,  0x53,  0x4b,  0x5f,  0x43,  0x54,  0x52,  0x4c,  
+	0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x53,  0x65,  0x6e,  0x73,  0x6f,  
+	0x72,  0x20,  0x74,  0x61,  0x73,  0x6b,  0x20,  0x28,  
+	0x6d,  0x61,  0x78,  0x2f,  0x62,  0x75,  0x64,  0x67,  
+	0x65,  0x74,  0x2c,  0x20,  0x6f,  0x76,  0x65,  0x72,  
+	0x72,  0x75,  0x6e,  0x73,  0x29,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x54,  
+	0x41,  0x53,  0x4b,  0x5f,  0x53,  0x45,  0x4e,  0x53,  
+	0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x50,  0x65,  0x72,  0x73,  0x69,  
+	0x73,  0x74,  0x65,  0x6e,  0x63,  0x65,  0x20,  0x74,  
+	0x61,  0x73,  0x6b,  0x20,  0x28,  0x6d,  0x61,  0x78,  
+	0x2f,  0x62,  0x75,  0x64,  0x67,  0x65,  0x74,  0x2c,  
+	0x20,  0x6f,  0x76,  0x65,  0x72,  0x72,  0x75,  0x6e,  
+	0x73,  0x29,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x23,  0x54,  0x41,  0x53,  0x4b,  
+	0x5f,  0x50,  0x45,  0x52,  0x53,  0x23,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  0x3e,  
+	0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x57,  0x65,  0x62,  0x73,  0x65,  0x72,  0x76,  0x65,  
+	0x72,  0x20,  0x74,  0x61,  0x73,  0x6b,  0x20,  0x28,  
+	0x6d,  0x61,  0x78,  0x2f,  0x62,  0x75,  0x64,  0x67,  
+	0x65,  0x74,  0x2c,  0x20,  0x6f,  0x76,  0x65,  0x72,  
+	0x72,  0x75,  0x6e,  0x73,  0x29,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x54,  
+	0x41,  0x53,  0x4b,  0x5f,  0x48,  0x54,  0x54,  0x50,  
+	0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  
+	0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  
+	0x74,  0x64,  0x3e,  0x52,  0x65,  0x6c,  0x61,  0x79,  
+	0x20,  0x75,  0x70,  0x64,  0x61,  0x74,  0x65,  0x73,  
+	0x20,  0x28,  0x64,  0x6f,  0x6e,  0x65,  0x2f,  0x73,  
+	0x6b,  0x69,  0x70,  0x70,  0x65,  0x64,  0x29,  0x3c,  
+	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x23,  0x52,  0x45,  0x4c,  0x55,  0x50,  0x44,  0x23,  
+	0x2f,  0x23,  0x52,  0x45,  0x4c,  0x55,  0x50,  0x44,  
+	0x5f,  0x53,  0x4b,  0x49,  0x50,  0x23,  0x3c,  0x2f,  
+	0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  0x3e,  
+	0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  
+	0x53,  0x77,  0x69,  0x74,  0x63,  0x68,  0x65,  0x73,  
+	0x20,  0x68,  0x65,  0x6c,  0x64,  0x20,  0x62,  0x61,  
+	0x63,  0x6b,  0x20,  0x62,  0x79,  0x20,  0x74,  0x68,  
+	0x65,  0x20,  0x72,  0x65,  0x6c,  0x61,  0x79,  0x20,  
+	0x64,  0x65,  0x6c,  0x61,  0x79,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x53,  
+	0x57,  0x5f,  0x48,  0x45,  0x4c,  0x44,  0x23,  0x3c,  
+	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  
+	0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x45,  0x45,  0x50,  0x52,  0x4f,  0x4d,  0x20,  
+	0x62,  0x79,  0x74,  0x65,  0x73,  0x20,  0x77,  0x72,  
+	0x69,  0x74,  0x74,  0x65,  0x6e,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x45,  
+	0x45,  0x5f,  0x42,  0x59,  0x54,  0x45,  0x53,  0x23,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  
+	0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  0x3c,  0x74,  
+	0x64,  0x3e,  0x45,  0x45,  0x50,  0x52,  0x4f,  0x4d,  
+	0x20,  0x72,  0x65,  0x63,  0x6f,  0x72,  0x64,  0x73,  
+	0x20,  0x77,  0x72,  0x69,  0x74,  0x74,  0x65,  0x6e,  
+	0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x74,  0x64,  
+	0x3e,  0x23,  0x45,  0x45,  0x5f,  0x52,  0x45,  0x43,  
+	0x53,  0x23,  0x3c,  0x2f,  0x74,  0x64,  0x3e,  0x3c,  
+	0x2f,  0x74,  0x72,  0x3e,  0x3c,  0x74,  0x72,  0x3e,  
+	0x3c,  0x74,  0x64,  0x3e,  0x43,  0x6f,  0x61,  0x6c,  
+	0x65,  0x73,  0x63,  0x65,  0x64,  0x20,  0x63,  0x68,  
+	0x61,  0x6e,  0x67,  0x65,  0x73,  0x3c,  0x2f,  0x74,  
+	0x64,  0x3e,  0x3c,  0x74,  0x64,  0x3e,  0x23,  0x45,  
+	0x45,  0x5f,  0x43,  0x4f,  0x41,  0x4c,  0x23,  0x3c,  
+	0x2f,  0x74,  0x64,  0x3e,  0x3c,  0x2f,  0x74,  0x72,  
+	0x3e,  0x3c,  0x2f,  0x74,  0x61,  0x62,  0x6c,  0x65,  
+	0x3e,  0x3c,  0x2f,  0x62,  0x6f,  0x64,  0x79,  0x3e,  
+	0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x00
+};
+
+// unsigned int stats_html_len = 1080;
+
+enum HtmlPageId {
+	PAGE_ABOUT_HTML,
+	PAGE_API_RELAYS,
+	PAGE_API_STATE,
+	PAGE_API_TIME,
+	PAGE_API_VERSION,
+	PAGE_EVENTS,
+	PAGE_HISTORY_CSV,
+	PAGE_INDEX_HTML,
+	PAGE_LEFT_HTML,
+	PAGE_MAIN_HTML,
+	PAGE_METRICS,
+	PAGE_NET_HTML,
+	PAGE_OPTS_HTML,
+	PAGE_SCENES_HTML,
+	PAGE_SCHED_HTML,
+	PAGE_SCK_HTML,
+	PAGE_STATS_HTML,
+	HTML_PAGES_NO
 };
 
-// unsigned int sck_html_len = 703;
+const char * const html_page_names[] PROGMEM = {
+	about_html_name,
+	api_relays_name,
+	api_state_name,
+	api_time_name,
+	api_version_name,
+	events_name,
+	history_csv_name,
+	index_html_name,
+	left_html_name,
+	main_html_name,
+	metrics_name,
+	net_html_name,
+	opts_html_name,
+	scenes_html_name,
+	sched_html_name,
+	sck_html_name,
+	stats_html_name
+};
 
+const unsigned int html_page_sizes[] PROGMEM = {
+	sizeof (about_html) - 1,
+	sizeof (api_relays) - 1,
+	sizeof (api_state) - 1,
+	sizeof (api_time) - 1,
+	sizeof (api_version) - 1,
+	sizeof (events) - 1,
+	sizeof (history_csv) - 1,
+	sizeof (index_html) - 1,
+	sizeof (left_html) - 1,
+	sizeof (main_html) - 1,
+	sizeof (metrics) - 1,
+	sizeof (net_html) - 1,
+	sizeof (opts_html) - 1,
+	sizeof (scenes_html) - 1,
+	sizeof (sched_html) - 1,
+	sizeof (sck_html) - 1,
+	sizeof (stats_html) - 1
+};
@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+#
+# This file is part of SmartStrip.
+#
+# Copyright (C) 2012-2016 by SukkoPera
+#
+# SmartStrip is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# SmartStrip is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Turns the pages in html/ into html.h.
+
+Every file under html/ becomes a page, served with its path relative to html/
+(e.g.: html/api/state becomes /api/state). The names of the C arrays are
+derived from the same path, with any non-alphanumeric character replaced by
+an underscore (e.g.: about_html and about_html_name for html/about.html).
+
+Run this from the top directory of the sketch after editing any page:
+
+    python3 tools/html2h.py
+
+Every page is stored in flash as a NUL-terminated array (which is the only
+format Webbino can render, see "Webbino limits" in README), after being
+minified: comments are dropped, each line is stripped of leading and trailing
+whitespace, runs of blanks are collapsed and all lines are joined together.
+All the #TAGS# used in the pages are checked against the ones defined in
+SmartStrip.ino, so that a typo does not go unnoticed until the page is
+rendered.
+
+Parts of a page can be repeated with:
+
+    <!--#repeat COUNT-->
+    ...
+    <!--#end-->
+
+where COUNT is either a number or the name of a #define in common.h (e.g.:
+RELAYS_NO), or HTML_PAGES_NO for the number of pages, or a sum of those (e.g.:
+HISTORY_FINE_LEN + HISTORY_COARSE_LEN + 1). Within the repeated
+part, $n is replaced with the number of the repetition, starting from 1, and
+$sep with a comma, except in the last one.
+
+Parts of a page that only make sense with some feature can be wrapped in:
+
+    <!--#ifdef NAME-->
+    ...
+    <!--#endif-->
+
+which ends up between #ifdef NAME and #endif in html.h, so that they are only
+compiled in when NAME is defined (e.g.: ENABLE_THERMOMETER). These can contain
+repeated parts, but not the other way round, and cannot be nested.
+
+Since lines are joined, $eol must be used where a line break is needed in the
+output, e.g. in plain text pages.
+
+Besides the pages themselves, html.h also gets an enum with the index of
+every page (e.g.: PAGE_ABOUT_HTML), together with tables of the names and
+sizes of all pages, in the same order.
+
+Use --check to verify that html.h is up to date without touching it, and
+--report to see how many bytes every page takes in flash and on the wire.
+"""
+
+import argparse
+import gzip
+import os
+import re
+import sys
+
+HTML_DIR = "html"
+HEADER = "html.h"
+SKETCH = "SmartStrip.ino"
+CONFIG = "common.h"
+
+TAG_RE = re.compile (rb"#([A-Za-z0-9_]+)#")
+SKETCH_TAG_RE = re.compile (r'^const char sub\w+Str\[\] PROGMEM = "([^"]+)";', re.M)
+DEFINE_RE = re.compile (r"^#define (\w+) (\d+)\s*$", re.M)
+REPEAT_RE = re.compile (rb"<!--#repeat ([\w +]+)-->(.*?)<!--#end-->", re.S)
+IFDEF_RE = re.compile (rb"<!--#ifdef (\w+)-->(.*?)<!--#endif-->", re.S)
+
+GENERATED_NOTICE = "// Generated by tools/html2h.py from the pages in html/, do not edit by hand!\n\n"
+
+# Tags starting with these are handled by Webbino itself
+BUILTIN_TAG_PREFIXES = ("GETP_", )
+
+
+COMMENT_RE = re.compile (rb"<!--.*?-->", re.S)
+BLANKS_RE = re.compile (rb"[ \t]+")
+SELF_CLOSING_RE = re.compile (rb" />")
+EOL_RE = re.compile (rb"\$eol")
+
+
+def expand (data, defines):
+	def repeat (m):
+		count = 0
+		for term in m.group (1).decode ("ascii").split ("+"):
+			term = term.strip ()
+			if term.isdigit ():
+				count += int (term)
+			elif term in defines:
+				count += defines[term]
+			else:
+				raise ValueError ("%s is not defined in %s" % (term, CONFIG))
+
+		body = m.group (2)
+		return b"".join (body.replace (b"$n", str (i + 1).encode ()).replace (b"$sep", b"," if i < count - 1 else b"")
+		                 for i in range (count))
+
+	return REPEAT_RE.sub (repeat, data)
+
+
+def minify (data):
+	data = COMMENT_RE.sub (b"", data)
+	data = b"".join (line.strip () for line in data.split (b"\n"))
+	data = BLANKS_RE.sub (b" ", data)
+	data = SELF_CLOSING_RE.sub (b"/>", data)
+	data = EOL_RE.sub (b"\n", data)
+	return data
+
+
+def split_ifdefs (data):
+	"""Returns a list of (NAME, part) tuples, where NAME is None for the parts
+	that are always there.
+	"""
+	parts = []
+	pos = 0
+	for m in IFDEF_RE.finditer (data):
+		parts.append ((None, data[pos:m.start ()]))
+		parts.append ((m.group (1).decode ("ascii"), m.group (2)))
+		pos = m.end ()
+	parts.append ((None, data[pos:]))
+	return parts
+
+
+def list_pages ():
+	pages = []
+	for root, dirs, files in os.walk (HTML_DIR):
+		for f in files:
+			path = os.path.join (root, f)
+			pages.append (os.path.relpath (path, HTML_DIR).replace (os.sep, "/"))
+	return sorted (pages)
+
+
+def page_symbol (page):
+	return re.sub (r"[^A-Za-z0-9]", "_", page)
+
+
+def page_to_c (page, parts):
+	symbol = page_symbol (page)
+
+	# The NUL must always be there
+	parts = [(name, data) for name, data in parts if data]
+	if parts and parts[-1][0] is None:
+		parts[-1] = (None, parts[-1][1] + b"\0")
+	else:
+		parts.append ((None, b"\0"))
+
+	out = []
+	out.append ('const char %s_name[] PROGMEM = "/%s";\n\n' % (symbol, page))
+	out.append ("const char %s[] PROGMEM = {\n" % symbol)
+	for k, (name, data) in enumerate (parts):
+		if name:
+			out.append ("#ifdef %s\n" % name)
+		for i in range (0, len (data), 8):
+			chunk = data[i:i + 8]
+			last = k == len (parts) - 1 and i + 8 >= len (data)
+			out.append ("\t" + ",  ".join ("0x%02x" % b for b in chunk) + ("" if last else ",  ") + "\n")
+		if name:
+			out.append ("#endif\n")
+	out.append ("};\n\n")
+	out.append ("// unsigned int %s_len = %d;\n\n" % (symbol, sum (len (data) for _, data in parts)))
+	return "".join (out)
+
+
+def page_tables (pages):
+	symbols = [page_symbol (page) for page in pages]
+	out = []
+	out.append ("enum HtmlPageId {\n")
+	out.extend ("\tPAGE_%s,\n" % symbol.upper () for symbol in symbols)
+	out.append ("\tHTML_PAGES_NO\n};\n\n")
+	out.append ("const char * const html_page_names[] PROGMEM = {\n")
+	out.append (",\n".join ("\t%s_name" % symbol for symbol in symbols))
+	out.append ("\n};\n\n")
+	out.append ("const unsigned int html_page_sizes[] PROGMEM = {\n")
+	out.append (",\n".join ("\tsizeof (%s) - 1" % symbol for symbol in symbols))
+	out.append ("\n};\n")
+	return "".join (out)
+
+
+def main ():
+	parser = argparse.ArgumentParser (description = "Convert html/* to html.h")
+	parser.add_argument ("--check", action = "store_true", help = "only check that html.h is up to date")
+	parser.add_argument ("--report", action = "store_true", help = "print the size of every page")
+	args = parser.parse_args ()
+
+	with open (SKETCH) as f:
+		known_tags = set (SKETCH_TAG_RE.findall (f.read ()))
+	with open (CONFIG) as f:
+		defines = {name: int (value) for name, value in DEFINE_RE.findall (f.read ())}
+	pages = list_pages ()
+	defines["HTML_PAGES_NO"] = len (pages)
+
+	ok = True
+	out = []
+	total_src = total_min = 0
+	if args.report:
+		print ("%-12s %8s %8s %8s  %s" % ("Page", "Source", "Flash", "Gzipped", "Tags"))
+
+	for page in pages:
+		path = os.path.join (HTML_DIR, page)
+		with open (path, "rb") as f:
+			src = f.read ()
+		try:
+			parts = [(name, minify (expand (part, defines))) for name, part in split_ifdefs (src)]
+		except ValueError as e:
+			print ("%s: %s" % (path, e), file = sys.stderr)
+			return 1
+		data = b"".join (part for _, part in parts)
+
+		tags = TAG_RE.findall (data)
+		if args.report:
+			# Pages with tags can't be compressed, since they're filled in while being
+			# sent. The others could, but Webbino can't send them (see README).
+			gz = "-" if tags else str (len (gzip.compress (data, 9)))
+			print ("%-12s %8d %8d %8s  %d" % (page, len (src), len (data) + 1, gz, len (tags)))
+		total_src += len (src)
+		total_min += len (data) + 1
+
+		for tag in tags:
+			tag = tag.decode ("ascii")
+			if tag not in known_tags and not tag.startswith (BUILTIN_TAG_PREFIXES):
+				print ("%s: unknown tag #%s#" % (path, tag), file = sys.stderr)
+				ok = False
+
+		out.append (page_to_c (page, parts))
+
+	out = GENERATED_NOTICE + "".join (out) + page_tables (pages)
+	if args.report:
+		print ("%-12s %8d %8d" % ("Total", total_src, total_min))
+	if args.check:
+		with open (HEADER) as f:
+			if f.read () != out:
+				print ("%s is out of date, please run %s" % (HEADER, sys.argv[0]), file = sys.stderr)
+				ok = False
+	else:
+		with open (HEADER, "w") as f:
+			f.write (out)
+
+	return 0 if ok else 1
+
+
+if __name__ == "__main__":
+	sys.exit (main ())
@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+#
+# This file is part of SmartStrip.
+#
+# Copyright (C) 2012-2016 by SukkoPera
+#
+# SmartStrip is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# SmartStrip is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with SmartStrip.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Client for the UDP control protocol (see ENABLE_UDP and UdpControl.h).
+
+Shows the mode and state of all relays:
+
+    python3 tools/udpctl.py smartstrip get
+
+Changes the mode of some relays at once (numbered from 1, modes as in
+/api/relays):
+
+    python3 tools/udpctl.py smartstrip set 1=on 2=off 3=gt
+
+Measures the round-trip time of GET requests, optionally comparing it with
+fetching /api/state over HTTP:
+
+    python3 tools/udpctl.py smartstrip bench -n 500 --http
+
+If the board has UDP_KEY defined, pass the same 16 bytes with --key, as hex.
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+import urllib.request
+
+MAGIC = ord ('S')
+VERSION = 1
+CMD_GET = 1
+CMD_SET = 2
+REPLY = 0x80
+
+STATUS = {
+	0: "ok",
+	1: "bad request",
+	2: "old sequence number",
+	3: "bad mode"
+}
+OLD_SEQ = 2
+
+MODES = ["on", "off", "gt", "lt", "sched"]
+MAX_RELAYS = 32
+
+# Everything but the MAC, then the MAC
+HEADER = struct.Struct ("<BBBBIII16s")
+PACKET_SIZE = HEADER.size + 8
+
+def rotl (x, b):
+	return ((x << b) | (x >> (64 - b))) & 0xFFFFFFFFFFFFFFFF
+
+def siphash24 (key, data):
+	k0, k1 = struct.unpack ("<QQ", key)
+	v = [
+		k0 ^ 0x736f6d6570736575,
+		k1 ^ 0x646f72616e646f6d,
+		k0 ^ 0x6c7967656e657261,
+		k1 ^ 0x7465646279746573
+	]
+	mask = 0xFFFFFFFFFFFFFFFF
+
+	def rounds (n):
+		for _ in range (n):
+			v[0] = (v[0] + v[1]) & mask
+			v[1] = rotl (v[1], 13) ^ v[0]
+			v[0] = rotl (v[0], 32)
+			v[2] = (v[2] + v[3]) & mask
+			v[3] = rotl (v[3], 16) ^ v[2]
+			v[0] = (v[0] + v[3]) & mask
+			v[3] = rotl (v[3], 21) ^ v[0]
+			v[2] = (v[2] + v[1]) & mask
+			v[1] = rotl (v[1], 17) ^ v[2]
+			v[2] = rotl (v[2], 32)
+
+	full = len (data) // 8 * 8
+	last = data[full:] + bytes (7 - len (data) % 8) + bytes ([len (data) & 0xFF])
+	for i in range (0, full + 8, 8):
+		m, = struct.unpack ("<Q", (data[:full] + last)[i:i + 8])
+		v[3] ^= m
+		rounds (2)
+		v[0] ^= m
+
+	v[2] ^= 0xFF
+	rounds (4)
+	return struct.pack ("<Q", v[0] ^ v[1] ^ v[2] ^ v[3])
+
+class Reply:
+	def __init__ (self, data, key):
+		magic, version, command, self.status, self.seq, self.mask, self.version, modes = HEADER.unpack (data[:HEADER.size])
+		if magic != MAGIC or version != VERSION or not command & REPLY:
+			raise ValueError ("Not a reply")
+		if key is not None and siphash24 (key, data[:HEADER.size]) != data[HEADER.size:]:
+			raise ValueError ("Bad MAC")
+		self.modes = [(modes[i // 2] >> (i % 2 * 4)) & 0x0F for i in range (MAX_RELAYS)]
+
+class Client:
+	def __init__ (self, host, port, key = None, timeout = 1.0):
+		self.addr = (socket.gethostbyname (host), port)
+		self.key = key
+		self.sock = socket.socket (socket.AF_INET, socket.SOCK_DGRAM)
+		self.sock.settimeout (timeout)
+
+		# Must only grow while the board is up, seconds will do as a start
+		self.seq = int (time.time ()) & 0xFFFFFFFF
+
+	def pack (self, command, mask = 0, modes = None):
+		self.seq = (self.seq + 1) & 0xFFFFFFFF
+		nibbles = bytearray (16)
+		for relay, mode in (modes or {}).items ():
+			nibbles[relay // 2] |= mode << (relay % 2 * 4)
+		header = HEADER.pack (MAGIC, VERSION, command, 0, self.seq, mask, 0, bytes (nibbles))
+		return header + (siphash24 (self.key, header) if self.key is not None else bytes (8))
+
+	def request (self, command, mask = 0, modes = None):
+		data = self.pack (command, mask, modes)
+		self.sock.sendto (data, self.addr)
+		while True:
+			# Skip replies to earlier requests that timed out
+			reply = Reply (self.sock.recv (PACKET_SIZE), self.key)
+			if reply.seq == self.seq or reply.status == OLD_SEQ:
+				break
+
+		if reply.status == OLD_SEQ:
+			# The board tells the last one it accepted, carry on from there
+			self.seq = reply.seq
+			return self.request (command, mask, modes)
+
+		return reply
+
+	def get (self):
+		return self.request (CMD_GET)
+
+	def set (self, modes):
+		mask = 0
+		for relay in modes:
+			mask |= 1 << relay
+		return self.request (CMD_SET, mask, modes)
+
+def show (reply, relays):
+	if reply.status != 0:
+		print ("Error: %s" % STATUS.get (reply.status, reply.status))
+	print ("State version: %u" % reply.version)
+	for i in range (relays):
+		mode = MODES[reply.modes[i]] if reply.modes[i] < len (MODES) else "?"
+		print ("Relay %d: %s, %s" % (i + 1, mode, "on" if reply.mask & (1 << i) else "off"))
+
+def percentile (values, p):
+	return values[min (len (values) - 1, int (len (values) * p / 100))]
+
+def report (name, times, lost):
+	if not times:
+		print ("%s: no replies" % name)
+		return
+	times.sort ()
+	print ("%s: %d requests, %d lost, min %.2f ms, median %.2f ms, 99th percentile %.2f ms, max %.2f ms" % (
+		name, len (times) + lost, lost, times[0], percentile (times, 50), percentile (times, 99), times[-1]))
+
+def bench (client, host, n, http):
+	times = []
+	lost = 0
+	for _ in range (n):
+		start = time.perf_counter ()
+		try:
+			client.get ()
+			times.append ((time.perf_counter () - start) * 1000)
+		except socket.timeout:
+			lost += 1
+	report ("UDP GET", times, lost)
+
+	if http:
+		times = []
+		lost = 0
+		url = "http://%s/api/state" % host
+		for _ in range (n):
+			start = time.perf_counter ()
+			try:
+				urllib.request.urlopen (url, timeout = client.sock.gettimeout ()).read ()
+				times.append ((time.perf_counter () - start) * 1000)
+			except OSError:
+				lost += 1
+		report ("HTTP /api/state", times, lost)
+
+def main ():
+	parser = argparse.ArgumentParser (description = "Control SmartStrip through UDP")
+	parser.add_argument ("host")
+	parser.add_argument ("command", choices = ["get", "set", "bench"])
+	parser.add_argument ("args", nargs = "*", help = "RELAY=MODE pairs, for set")
+	parser.add_argument ("-p", "--port", type = int, default = 5050)
+	parser.add_argument ("-k", "--key", help = "UDP_KEY, as 32 hex digits")
+	parser.add_argument ("-r", "--relays", type = int, default = 4, help = "number of relays to show")
+	parser.add_argument ("-t", "--timeout", type = float, default = 1.0, help = "seconds")
+	parser.add_argument ("-n", type = int, default = 100, help = "requests to send, for bench")
+	parser.add_argument ("--http", action = "store_true", help = "also benchmark HTTP, for comparison")
+	args = parser.parse_args ()
+
+	key = None
+	if args.key:
+		key = bytes.fromhex (args.key)
+		if len (key) != 16:
+			parser.error ("The key must be 16 bytes")
+
+	client = Client (args.host, args.port, key, args.timeout)
+	try:
+		if args.command == "get":
+			show (client.get (), args.relays)
+		elif args.command == "set":
+			modes = {}
+			for arg in args.args:
+				relay, _, mode = arg.partition ("=")
+				if not relay.isdigit () or not 1 <= int (relay) <= MAX_RELAYS or mode not in MODES:
+					parser.error ("Bad relay setting: %s" % arg)
+				modes[int (relay) - 1] = MODES.index (mode)
+			show (client.set (modes), args.relays)
+		else:
+			bench (client, args.host, args.n, args.http)
+	except socket.timeout:
+		print ("No reply", file = sys.stderr)
+		return 1
+	except ValueError as e:
+		print (e, file = sys.stderr)
+		return 1
+
+	return 0
+
+if __name__ == "__main__":
+	sys.exit (main ())